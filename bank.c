@@ -0,0 +1,130 @@
+#include <string.h>
+#include "engine.h"
+
+#if BANKED_ASSETS
+#include "bank.h"
+
+__at (BANK_CACHE_START) unsigned char bank_cache[BANK_SLOTS * BANK_SLOT_SIZE];  // Слоты кэша
+
+t_bank_asset bank_assets[BANK_MAX_ASSETS];
+unsigned char bank_asset_slots[BANK_MAX_ASSETS];
+static unsigned char slot_assets[BANK_SLOTS];    // Ассет в слоте или BANK_ASSET_NONE
+static unsigned char num_assets;
+static unsigned char alloc_bank;                 // Индекс в asset_banks[], куда идёт следующий ассет
+static unsigned int alloc_offset;                // Свободное место в этом банке
+
+// Банки под ассеты: 0 постоянно подключён в 0xC000 (pix_buffer, данные,
+// стек), 2 и 5 — всегда в 0x8000 и 0x4000, 7 — теневой экран
+static const unsigned char asset_banks[] = {1, 3, 4, 6};
+
+#ifdef __SDCC
+// Параметры копирования (передаются через память)
+static unsigned char copy_port;                  // Значение порта 0x7FFD с нужным банком
+static const void *copy_src;
+static void *copy_dst;
+static unsigned int copy_len;
+
+// LDIR при подключённом банке. Стек и переменные в это время недоступны:
+// всё нужное заранее в регистрах, прерывания запрещены. Прежнее состояние
+// прерываний восстанавливается по IFF2.
+static void bank_ldir() __naked {
+  __asm
+    ld a, i                     ; P/V = IFF2
+    jp pe, 00001$
+    ld a, i                     ; NMOS Z80: прерывание во время LD A,I сбрасывает P/V
+00001$:
+    push af
+    ld a, (_copy_port)
+    ld hl, (_copy_src)
+    ld de, (_copy_dst)
+    ld bc, (_copy_len)
+    exx
+    ld bc, #0x7ffd
+    ld e, #BANK_PORT_BASE
+    di
+    out (c), a                  ; Банк в окне 0xC000
+    exx
+    ldir
+    exx
+    out (c), e                  ; Банк 0 обратно: стек снова доступен
+    exx
+    pop af
+    ret po
+    ei
+    ret
+  __endasm;
+}
+
+static void bank_copy(unsigned char bank, void *p_dst, const void *p_src, unsigned int size) {
+  copy_port = BANK_PORT_BASE | bank;
+  copy_src = p_src;
+  copy_dst = p_dst;
+  copy_len = size;
+  bank_ldir();
+}
+
+#define BANK_ADDR(id, pos) ((unsigned char *)BANK_WINDOW_START + bank_assets[id].offset + (pos))
+#else
+// На хосте банки — обычные массивы
+static unsigned char host_banks[8][BANK_WINDOW_SIZE];
+
+#define bank_copy(bank, p_dst, p_src, size) memcpy(p_dst, p_src, size)
+#define BANK_ADDR(id, pos) (host_banks[bank_assets[id].bank] + bank_assets[id].offset + (pos))
+#endif
+
+void bank_init() {
+  num_assets = 0;
+  alloc_bank = 0;
+  alloc_offset = 0;
+  memset(bank_asset_slots, BANK_SLOT_NONE, sizeof(bank_asset_slots));
+  memset(slot_assets, BANK_ASSET_NONE, sizeof(slot_assets));
+}
+
+// Ассеты идут в банки подряд; не поместившийся в остаток банка начинает следующий
+unsigned char bank_alloc(unsigned int size) {
+  if (num_assets == BANK_MAX_ASSETS || size > BANK_SLOT_SIZE) return BANK_ASSET_NONE;
+  if (alloc_offset + size > BANK_WINDOW_SIZE) {
+    if (++alloc_bank == sizeof(asset_banks)) return BANK_ASSET_NONE;
+    alloc_offset = 0;
+  }
+  bank_assets[num_assets].bank = asset_banks[alloc_bank];
+  bank_assets[num_assets].offset = alloc_offset;
+  bank_assets[num_assets].size = size;
+  alloc_offset += size;
+  return num_assets++;
+}
+
+void bank_write(unsigned char id, unsigned int offset, const void *p_src, unsigned int size) {
+  if (size) bank_copy(bank_assets[id].bank, BANK_ADDR(id, offset), p_src, size);
+}
+
+// Слот, который можно занять: пустой или с ассетом вне маски needed
+static unsigned char free_slot(unsigned int needed) {
+  for (unsigned char slot = 0; slot < BANK_SLOTS; slot++) {
+    if (slot_assets[slot] == BANK_ASSET_NONE || !(needed & (1u << slot_assets[slot]))) return slot;
+  }
+  return BANK_SLOT_NONE;
+}
+
+// Недостающие ассеты маски грузятся по банкам: все ассеты одного банка
+// подряд. Ассеты маски не вытесняют друг друга, поэтому при нехватке слотов
+// часть остаётся на следующий вызов.
+unsigned int bank_fetch(unsigned int needed) {
+  unsigned int loaded = 0;
+  unsigned char b, id, slot;
+
+  for (b = 0; b < sizeof(asset_banks); b++) {
+    for (id = 0; id < num_assets; id++) {
+      if (bank_assets[id].bank != asset_banks[b] || !(needed & (1u << id)) || BANK_RESIDENT(id)) continue;
+      slot = free_slot(needed);
+      if (slot == BANK_SLOT_NONE) return loaded;
+      if (slot_assets[slot] != BANK_ASSET_NONE) bank_asset_slots[slot_assets[slot]] = BANK_SLOT_NONE;
+      slot_assets[slot] = id;
+      bank_asset_slots[id] = slot;
+      bank_copy(bank_assets[id].bank, bank_slot_data(id), BANK_ADDR(id, 0), bank_assets[id].size);
+      loaded |= 1u << id;
+    }
+  }
+  return loaded;
+}
+#endif
@@ -0,0 +1,38 @@
+#ifndef __BANK_H
+#define __BANK_H
+
+// === БАНКИ ПАМЯТИ 128K (BANKED_ASSETS) ===
+// Ассеты (наборы спрайтов материалов) лежат в банках, подключаемых в окно
+// 0xC000–0xFFFF через порт 0x7FFD, и подгружаются по требованию в слоты
+// резидентного кэша ниже 0xC000. Пока банк подключён, данные и стек
+// (0xF000–0xFFFF) и pix_buffer недоступны, поэтому копирование — одна
+// команда LDIR с запрещёнными прерываниями, параметры которой заранее
+// загружены в регистры.
+#define BANK_PORT_BASE 0x10            // ПЗУ 48K, экран 0, банк 0 в 0xC000
+#define BANK_WINDOW_START 0xc000
+#define BANK_WINDOW_SIZE 0x4000
+#define BANK_MAX_ASSETS 16             // Ассет — бит в маске unsigned int
+#define BANK_ASSET_NONE 0xff           // Ассет не помещается в слот или банки заполнены
+#define BANK_SLOT_NONE 0xff            // Ассет не в кэше
+
+// Где лежит ассет: номер банка и смещение в окне
+typedef struct {
+  unsigned char bank;
+  unsigned int offset;
+  unsigned int size;
+} t_bank_asset;
+
+extern t_bank_asset bank_assets[BANK_MAX_ASSETS];
+extern unsigned char bank_asset_slots[BANK_MAX_ASSETS]; // Слот кэша или BANK_SLOT_NONE
+extern unsigned char bank_cache[];
+
+// Ассет в кэше; его данные — bank_slot_data(id)
+#define BANK_RESIDENT(id) (bank_asset_slots[id] != BANK_SLOT_NONE)
+#define bank_slot_data(id) (bank_cache + (unsigned int)bank_asset_slots[id] * BANK_SLOT_SIZE)
+
+void bank_init();                                          // Пустые банки и кэш
+unsigned char bank_alloc(unsigned int size);               // Место под ассет; номер или BANK_ASSET_NONE
+void bank_write(unsigned char id, unsigned int offset, const void *p_src, unsigned int size); // Запись в ассет
+unsigned int bank_fetch(unsigned int needed);              // Подгрузка ассетов маски; маска загруженных
+
+#endif // __BANK_H
@@ -0,0 +1,133 @@
+#include "engine.h"
+#include "irq.h"
+#include "text.h"
+#include "demo.h"
+
+#if DEMO_MODE != DEMO_OFF
+static unsigned int start_frame;                 // frame_counter в начале записи или прогона
+
+// Строки отчёта: атрибуты ставятся, только если их не задал профилировщик
+static void show_message(const char *text) {
+#if !PROFILE_OVERLAY
+  text_set_row_attr(DEMO_TEXT_ROW, ATTR_BRIGHT | 7);
+  text_set_row_attr(DEMO_TEXT_ROW + 1, ATTR_BRIGHT | 7);
+#endif
+  text_put_string(DEMO_TEXT_ROW, DEMO_TEXT_COL, text);
+}
+#endif
+
+#if DEMO_MODE == DEMO_RECORD
+__at (DEMO_BUFFER_START) unsigned char demo_buffer[DEMO_BUFFER_SIZE];
+static unsigned int run_bytes;                   // Байт серий в буфере
+static unsigned char recording;                  // 0 — буфер полон или выгружен
+
+// Заголовок ленты: тип 3 (CODE), имя, длина, адрес, 32768
+static unsigned char tape_header[17] = {3, 'd', 'e', 'm', 'o', ' ', ' ', ' ', ' ', ' ', ' '};
+
+// Параметры SA-BYTES (передаются через память)
+static unsigned int save_start;
+static unsigned int save_length;
+static unsigned char save_flag;
+
+// Процедура ПЗУ портит IX (указатель кадра SDCC) и возвращается с EI.
+// BREAK во время записи уходит в обработчик ошибок BASIC — не нажимать.
+static void rom_save() __naked {
+  __asm
+    push ix
+    ld ix, (_save_start)
+    ld de, (_save_length)
+    ld a, (_save_flag)
+    call ROM_SA_BYTES
+    pop ix
+    ret
+  __endasm;
+}
+
+void demo_start() {
+  run_bytes = 0;
+  recording = 1;
+  demo_buffer[0] = 0;
+  demo_buffer[1] = 0;
+  start_frame = frame_counter;
+}
+
+// Тот же шаг продлевает последнюю серию, другой начинает новую
+void demo_record(unsigned char keys) {
+  unsigned char *p_run = demo_buffer + DEMO_HEADER_SIZE + run_bytes;
+
+  if (!recording) return;
+  if (run_bytes && p_run[-2] == keys && p_run[-1] != DEMO_MAX_RUN) {
+    p_run[-1]++;
+    return;
+  }
+  if (DEMO_HEADER_SIZE + run_bytes + 2 > DEMO_BUFFER_SIZE) {
+    recording = 0;
+    show_message("FULL");
+    return;
+  }
+  p_run[0] = keys;
+  p_run[1] = 1;
+  run_bytes += 2;
+  demo_buffer[0] = run_bytes & 0xff;
+  demo_buffer[1] = run_bytes >> 8;
+}
+
+void demo_save() {
+  unsigned int length = DEMO_HEADER_SIZE + run_bytes;
+
+  recording = 0;
+  tape_header[11] = length & 0xff;
+  tape_header[12] = length >> 8;
+  tape_header[13] = DEMO_BUFFER_START & 0xff;
+  tape_header[14] = DEMO_BUFFER_START >> 8;
+  tape_header[15] = 0x00;
+  tape_header[16] = 0x80;
+
+  save_start = (unsigned int)tape_header;
+  save_length = sizeof(tape_header);
+  save_flag = 0x00;
+  rom_save();
+  // Пауза между заголовком и данными, как у SAVE: загрузчику ПЗУ нужна тишина
+  for (unsigned char i = 0; i < 50; i++) irq_wait_frame();
+  save_start = DEMO_BUFFER_START;
+  save_length = length;
+  save_flag = 0xff;
+  rom_save();
+  show_message("SAVED");
+}
+#endif
+
+#if DEMO_MODE == DEMO_PLAYBACK
+#include "demo_data.h"
+
+static const unsigned char *p_run;               // Следующая серия
+static unsigned char run_keys;                   // Клавиши текущей серии
+static unsigned char run_left;                   // Оставшиеся шаги серии
+static unsigned int steps;                       // Шагов (кадров рендера) с начала прогона
+
+void demo_start() {
+  p_run = demo_data + DEMO_HEADER_SIZE;
+  run_left = 0;
+  steps = 0;
+  start_frame = frame_counter;
+}
+
+unsigned char demo_pop() {
+  if (!run_left) {
+    if (p_run == demo_data + DEMO_HEADER_SIZE + (demo_data[0] | (demo_data[1] << 8))) return INPUT_EMPTY;
+    run_keys = *p_run++;
+    run_left = *p_run++;
+  }
+  run_left--;
+  steps++;
+  return run_keys;
+}
+
+// Прерывания — время прогона в 1/50 с: рендер без ожидания кадра
+void demo_report() {
+  show_message("FRAMES");
+  text_put_uint(DEMO_TEXT_ROW, DEMO_TEXT_COL + 7, steps);
+  text_put_string(DEMO_TEXT_ROW + 1, DEMO_TEXT_COL, "INTS");
+  text_put_uint(DEMO_TEXT_ROW + 1, DEMO_TEXT_COL + 7, frame_counter - start_frame);
+}
+#endif
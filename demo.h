@@ -0,0 +1,42 @@
+#ifndef __DEMO_H
+#define __DEMO_H
+
+// === ЗАПИСЬ И ВОСПРОИЗВЕДЕНИЕ ВВОДА (ДЕМО) ===
+// DEMO_RECORD: каждый шаг обновления игрока (элемент очереди ввода) пишется
+// сериями «клавиши, повторы» в буфер по постоянному адресу; FIRE выгружает
+// запись на ленту (demo_save()). DEMO_PLAYBACK: шаги берутся из demo_data.h
+// (tools/demo/demo2h.py) по одному на рендер и без ожидания прерывания,
+// поэтому кадры прогона одинаковы на любой машине и совпадают со сценарием
+// demo2h.py --path для хостового стенда. В конце прогона внизу экрана
+// печатаются число кадров и прошедших прерываний, демо начинается заново.
+#define DEMO_OFF 0
+#define DEMO_RECORD 1
+#define DEMO_PLAYBACK 2
+#ifndef DEMO_MODE
+#define DEMO_MODE DEMO_OFF
+#endif
+
+// Буфер записи: свободен во всех режимах (выше кэша текстур и экрана 1,
+// ниже pix_attr_buffer), дамп памяти эмулятора с этого адреса годится для
+// demo2h.py. Формат: длина серий (2 байта), затем пары (клавиши, повторы).
+#define DEMO_BUFFER_START 0xdb00
+#define DEMO_BUFFER_SIZE 0x300
+#define DEMO_HEADER_SIZE 2
+#define DEMO_MAX_RUN 255
+#define DEMO_TEXT_ROW 16               // Отчёт: две строки нижней трети справа,
+#define DEMO_TEXT_COL 20               // рядом с таблицей PROFILE_OVERLAY
+
+// Запись на ленту из ПЗУ 48K: SA-BYTES (IX — адрес, DE — длина, A — флаг)
+#define ROM_SA_BYTES 0x04c2
+
+void demo_start();                     // Начало записи или прогона (счётчик прерываний — с нуля)
+#if DEMO_MODE == DEMO_RECORD
+void demo_record(unsigned char keys);  // Шаг с состоянием клавиш keys
+void demo_save();                      // Запись на ленту: заголовок CODE "demo" и блок данных
+#endif
+#if DEMO_MODE == DEMO_PLAYBACK
+unsigned char demo_pop();              // Клавиши следующего шага или INPUT_EMPTY в конце демо
+void demo_report();                    // Печатает шаги и прерывания прогона
+#endif
+
+#endif // __DEMO_H
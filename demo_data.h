@@ -0,0 +1,11 @@
+#ifndef __DEMO_DATA_H
+#define __DEMO_DATA_H
+
+// Сгенерировано tools/demo/demo2h.py из tools/demo/attract.txt — не редактировать.
+// 15 серий, 1215 шагов (~24.3 с при 50 шагах в секунду).
+static const unsigned char demo_data[] = {
+  0x1e,0x00,0x01,0x08,0x04,0x0c,0x02,0x08,0x04,0xff,0x04,0x89,0x02,0x20,0x04,0x31,
+  0x01,0x20,0x04,0x55,0x02,0x20,0x04,0x22,0x02,0x20,0x04,0xff,0x04,0xb4,0x02,0x40
+};
+
+#endif // __DEMO_DATA_H
@@ -1,29 +1,405 @@
 #include <string.h>
 #include "engine.h"
+#include "sincos.h"
+#include "scr_lines.h"
+#include "wall_sprites.h"
+#include "map_data.h"
+#include "unpack.h"
 
 // Экранная память ZX Spectrum: пиксели и атрибуты
 __at (SCREEN_BUFFER_START) char screen_buf[0x1800];        // 6144 байт пикселей
 __at (ATTR_SCREEN_BUFFER_START) char attr_buf[0x300];      // 768 байт атрибутов
 
 // Внешние буферы для рендеринга (вне экранной области)
-__at (PIX_BUFFER_START) char pix_buffer[PIX_BUFFER_SIZE];              // Пиксельный буфер 128x32
+__at (PIX_BUFFER_START) char pix_buffer[PIX_BUFFER_SIZE];              // Пиксельный буфер VIEW_HEIGHT x VIEW_WIDTH
 __at (PIX_ATTR_BUFFER_START) char pix_attr_buffer[PIX_ATTR_BUFFER_SIZE]; // Атрибутный буфер
 
+#if SHADOW_SCREEN
+#include "irq.h"
+__at (SHADOW_SCREEN_START) char shadow_screen_buf[SHADOW_SCREEN_SIZE];  // Экран 1 (банк 7)
+__sfr __banked __at (0x7ffd) bank_port;                                 // Управление памятью 128K
+#endif
+
 // === ВСПОМОГАТЕЛЬНЫЕ МАССИВЫ ===
-static int distance_deltas[MAX_DISTANCE];        // Разности высот стен между соседними дистанциями
-static unsigned char wall_height_buffer[SCR_WIDTH]; // Высота стены для каждого столбца экрана (0–31)
-static unsigned char old_wall_height_buffer[SCR_WIDTH]; // Высота стены для каждого столбца экрана (0–31)
+static unsigned int distance_deltas[MAX_DISTANCE]; // Разности высот стен между соседними дистанциями
+static unsigned char wall_height_buffer[VIEW_WIDTH]; // Высота стены для каждого столбца экрана (0–31)
+static unsigned char wall_material_buffer[VIEW_WIDTH]; // Материал стены для каждого столбца
+static unsigned char ray_material;               // Материал последней стены, найденной trace_ray()
+#if VIEW_FOV != VIEW_WIDTH
+static signed char ray_angles[VIEW_WIDTH];       // Угол луча столбца от направления взгляда
+#endif
+#if COHERENT_TRACE
+static unsigned int ray_cell;                    // Клетка попадания последнего луча: (y << 8) | x
+static unsigned char ray_hit_step;               // Шаг марша, на котором луч попал в стену
+static unsigned int column_cells[VIEW_WIDTH];     // Клетка попадания каждого столбца
+static unsigned char column_steps[VIEW_WIDTH];    // Шаг попадания каждого столбца
+#endif
+static const t_sprite *material_sprites[NUM_WALL_MATERIALS][MAX_PROJECTION_HEIGHT + 1]; // Спрайт по материалу и высоте
+#if BANKED_ASSETS
+static t_sprite banked_sprites[NUM_WALL_MATERIALS * WALL_LODS]; // Копии all_sprites[]: пиксели — в слоте кэша
+static unsigned int banked_offsets[NUM_WALL_MATERIALS * WALL_LODS]; // Смещение пикселей LOD в ассете материала
+#endif
+#if SHADOW_SCREEN
+static char *screen_lines[2][PIX_BUFFER_HEIGHT];        // Адреса строк экрана 0 и экрана 1
+static unsigned char screen_wall_heights[2][VIEW_WIDTH]; // Высоты стен, нарисованные на каждом экране
+static unsigned char back_screen;                       // Экран, в который идёт рендер
+static char **back_lines;                               // Адреса строк заднего экрана
+static char *back_attrs;                                // Атрибуты заднего экрана
+static unsigned char *old_wall_height_buffer;           // Высоты стен на заднем экране
+static unsigned char screen_wall_materials[2][VIEW_WIDTH]; // Материалы стен на каждом экране
+static unsigned char *old_wall_material_buffer;         // Материалы стен на заднем экране
+#else
+static unsigned char old_wall_height_buffer[VIEW_WIDTH]; // Высота стены для каждого столбца экрана (0–31)
+static unsigned char old_wall_material_buffer[VIEW_WIDTH]; // Нарисованный материал столбца
+#endif
+
+#if ROTATE_REUSE
+static unsigned char ray_height_buffer[VIEW_WIDTH]; // Высоты до сглаживания (результат трассировки)
+static int last_player_x, last_player_y;         // Позиция и угол предыдущего кадра
+static unsigned char last_player_angle;
+static unsigned char reuse_valid;                // Есть ли кадр, от которого можно сдвигать
+#endif
+
+#if ADAPTIVE_RES
+static unsigned char ray_step = 1;               // Трассируется каждый ray_step-й столбец
+#define RAY_STEP ray_step
+#else
+#define RAY_STEP 1
+#endif
+
+#if DIRTY_BLIT
+// Верхняя изменённая строка каждого столбца; стены симметричны относительно
+// середины буфера, поэтому изменённый диапазон — [top, PIX_BUFFER_HEIGHT - top)
+static unsigned char dirty_top[VIEW_WIDTH];
+#endif
+
+#if PRESCALED_TEXTURES
+__at (TEXTURE_CACHE_START) char texture_cache[TEXTURE_CACHE_SIZE];  // Столбцы текстур по высотам
+static t_texture textures[MAX_PROJECTION_HEIGHT + 1];              // Индекс кэша по высоте стены
+#endif
+
+static unsigned char hit_heights[MAX_DISTANCE];  // Высота стены при попадании на шаге d
+
+#if TRACE_ASM
+// Таблицы ядра марша, индекс — старший байт координаты (см. engine.h)
+__at (TRACE_COLS_START) unsigned char trace_cols[256];       // Смещение клетки X в строке карты
+__at (TRACE_MASKS_START) unsigned char trace_masks[256];     // Маска клетки X в байте карты
+__at (TRACE_ROWS_START) unsigned char trace_rows[256];       // Младший байт адреса строки Y
+__at (TRACE_ROWS_HI_START) unsigned char trace_rows_hi[256]; // Старший байт адреса строки Y
+// Параметры и результат ядра (передаются через память)
+static int trace_x, trace_y;                     // Начало луча (8.8)
+static int trace_cos, trace_sin;                 // Шаг луча
+static unsigned char trace_steps;                // Число проверок карты, после которых стена невидима
+static unsigned char trace_hit_step;             // Шаг попадания; MAX_DISTANCE — промах
+static unsigned char trace_cell_x, trace_cell_y; // Клетка попадания
+#endif
+
+#if FLOOR_DITHER
+static unsigned char gap_patterns[PIX_BUFFER_HEIGHT];  // Байт заливки строки вне стены
+#define GAP_BYTE(row) gap_patterns[row]
+#else
+#define GAP_BYTE(row) 0x00
+#endif
+
+#if TRACE_MODE == TRACE_SKIP
+#include "map_dist.h"
+#endif
+
+// Объекты и их проекции текущего кадра
+static t_object objects[MAX_OBJECTS];
+static unsigned char num_objects;
+static unsigned char object_tan_offsets[OBJECT_MAX_TAN + 1];  // Смещение в столбцах по 64 * |side / fwd|
+static unsigned char object_buckets[MAX_DISTANCE];  // Первый объект на шаге d (OBJECT_NONE — нет)
+static unsigned char object_next[MAX_OBJECTS];      // Следующий объект того же шага
+static signed char object_left[MAX_OBJECTS];        // Левый столбец проекции (может быть < 0)
+static unsigned char object_height[MAX_OBJECTS];    // Полувысота стены на дистанции объекта
+
+#if TRACE_MODE == TRACE_DDA
+static unsigned int ray_recip[128];              // 127 * 256 / |sin|: длина луча на одну клетку (8.8)
+static unsigned char ray_fisheye[VIEW_WIDTH];     // cos смещения столбца от центра (x256) для перпендикуляра
+static unsigned char dda_heights[DDA_MAX_DISTANCE >> DDA_HEIGHT_SHIFT]; // Высота стены по дистанции
+#endif
+
+
+#if SHADOW_SCREEN
+// Делает экран с индексом index задним (в него рисует следующий кадр)
+static void select_back_screen(unsigned char index) {
+  back_screen = index;
+  back_lines = screen_lines[index];
+  back_attrs = index ? shadow_screen_buf + 0x1800 : attr_buf;
+  old_wall_height_buffer = screen_wall_heights[index];
+  old_wall_material_buffer = screen_wall_materials[index];
+}
+
+// === ИНИЦИАЛИЗАЦИЯ ТЕНЕВОГО ЭКРАНА ===
+static void init_shadow_screen() {
+#ifdef __SDCC
+  // Банк 7 заменяет в 0xC000 банк 0, где лежат данные и стек: переносим их
+  // через экран 0. Прерывания ещё запрещены, а стек между копиями не меняется.
+  memcpy(screen_buf, (char *)UPPER_DATA_START, (unsigned int)(0x10000L - UPPER_DATA_START));
+  bank_port = BANK_PORT_SCREEN0;
+  memcpy((char *)UPPER_DATA_START, screen_buf, (unsigned int)(0x10000L - UPPER_DATA_START));
+#endif
 
+  // Верхние две трети обоих экранов очищаются, нижняя треть и атрибуты
+  // экрана 1 повторяют экран 0
+  memset(screen_buf, 0x00, VIEW_AREA_SIZE);
+  memset(shadow_screen_buf, 0x00, VIEW_AREA_SIZE);
+  memcpy(shadow_screen_buf + VIEW_AREA_SIZE, screen_buf + VIEW_AREA_SIZE, 0x1800 - VIEW_AREA_SIZE);
+  memcpy(shadow_screen_buf + 0x1800, attr_buf, ATTR_SCREEN_BUFFER_SIZE);
+
+  for (unsigned char i = 0; i < PIX_BUFFER_HEIGHT; i++) {
+    screen_lines[0][i] = VIEW_LINE(i);
+    screen_lines[1][i] = shadow_screen_buf + (VIEW_LINE(i) - screen_buf);
+#if FLOOR_DITHER
+    memset(screen_lines[0][i], gap_patterns[i], VIEW_WIDTH);
+    memset(screen_lines[1][i], gap_patterns[i], VIEW_WIDTH);
+#endif
+  }
+  memset(screen_wall_heights, 0, sizeof(screen_wall_heights));
+  memset(screen_wall_materials, 0, sizeof(screen_wall_materials));
+  select_back_screen(1);  // Показан экран 0
+}
+
+// === ПЕРЕКЛЮЧЕНИЕ ЭКРАНОВ ===
+void flip_screens() {
+  // Переключаем по кадровому прерыванию, пока луч в верхнем бордюре
+  irq_wait_frame();
+  bank_port = back_screen ? BANK_PORT_SCREEN1 : BANK_PORT_SCREEN0;
+  select_back_screen(back_screen ^ 1);
+}
+#endif
+
+
+#if COHERENT_TRACE
+// === КОГЕРЕНТНАЯ ТРАССИРОВКА ===
+// Параметры кадра для рекурсии (передаются через память, а не по стеку)
+static unsigned char *p_coherent_heights;
+static int coherent_x, coherent_y, coherent_angle;
+
+static void trace_column(unsigned char col) {
+#if TRACE_MODE == TRACE_SKIP
+  p_coherent_heights[col] = trace_ray_skip(col, coherent_x, coherent_y, coherent_angle);
+#else
+  p_coherent_heights[col] = trace_ray(col, coherent_x, coherent_y, coherent_angle);
+#endif
+  wall_material_buffer[col] = ray_material;
+  column_cells[col] = ray_cell;
+  column_steps[col] = ray_hit_step;
+}
+
+// Проверка без марша: луч столбца col на шаге d в клетке cell, а на шаге
+// d - 1 ещё в пустоте. Луч, попавший раньше (ближе концов отрезка — так
+// бывает у грани, видимой почти в упор) или позже, проверку не проходит.
+static unsigned char column_hits_at(unsigned char col, unsigned int cell, unsigned char d) {
+  unsigned char eff_angle = (RAY_ANGLE(col) + coherent_angle) & 0xff;
+  int sin = SIN(eff_angle);
+  int cos = COS(eff_angle);
+  int x = coherent_x + cos * d;
+  int y = coherent_y + sin * d;
+  unsigned char cell_x = x >> 8;
+  unsigned char cell_y = y >> 8;
+
+  if ((((unsigned int)cell_y << 8) | cell_x) != cell) return 0;
+  cell_x = (x - cos) >> 8;
+  cell_y = (y - sin) >> 8;
+  return MAP_WALL_AT(cell_x, cell_y) == 0;
+}
+
+// Столбцы left и right уже трассированы; заполняет или делит (left, right)
+static void trace_span(unsigned char left, unsigned char right) {
+  unsigned char mid, col;
+  unsigned int cell = column_cells[left];
+  unsigned char d = column_steps[left];
+
+  if (right - left < 2) return;
+  if (cell == column_cells[right] && cell != RAY_CELL_NONE && d == column_steps[right] && d > 0) {
+    // Концы попали в одну клетку на одном шаге: остальные лучи проверяются
+    // двумя чтениями карты вместо марша
+    for (col = left + 1; col < right; col++) {
+      if (!column_hits_at(col, cell, d)) break;
+    }
+    if (col == right) {
+      memset(p_coherent_heights + left + 1, p_coherent_heights[left], right - left - 1);
+      memset(wall_material_buffer + left + 1, wall_material_buffer[left], right - left - 1);
+      return;
+    }
+  }
+  mid = (left + right) >> 1;
+  trace_column(mid);
+  trace_span(left, mid);
+  trace_span(mid, right);
+}
+
+// Трассирует столбцы [start, end): опорные лучи через COHERENT_SPAN и крайний
+void trace_coherent(unsigned char *p_heights, unsigned char start, unsigned char end,
+                    int player_x, int player_y, int player_angle) {
+  unsigned char col = start;
+
+  if (start >= end) return;
+  p_coherent_heights = p_heights;
+  coherent_x = player_x;
+  coherent_y = player_y;
+  coherent_angle = player_angle;
+
+  trace_column(start);
+  for (; col + COHERENT_SPAN < end; col += COHERENT_SPAN) {
+    trace_column(col + COHERENT_SPAN);
+    trace_span(col, col + COHERENT_SPAN);
+  }
+  if (col != end - 1) {
+    trace_column(end - 1);
+    trace_span(col, end - 1);
+  }
+}
+#endif
+
+#if ADAPTIVE_RES
+// === ИНТЕРПОЛЯЦИЯ ПРОПУЩЕННЫХ СТОЛБЦОВ ===
+// Высота между трассированными столбцами — линейный градиент, как при
+// сглаживании краёв; рядом с пустым столбцом (0) — копия ближайшего.
+// Материал берётся от ближайшего трассированного столбца.
+static void interpolate_columns(unsigned char *p_heights) {
+  unsigned char col, i, h0, h1;
+  unsigned char half = ray_step >> 1;
+
+  for (col = 0; col + ray_step < VIEW_WIDTH; col += ray_step) {
+    h0 = p_heights[col];
+    h1 = p_heights[col + ray_step];
+    for (i = 1; i < ray_step; i++) {
+      if (h0 && h1) p_heights[col + i] = h0 + ((int)(h1 - h0) * i) / ray_step;
+      else p_heights[col + i] = i < half ? h0 : h1;
+      wall_material_buffer[col + i] = wall_material_buffer[i < half ? col : col + ray_step];
+    }
+  }
+  // Хвост за последним трассированным столбцом
+  for (i = col + 1; i < VIEW_WIDTH; i++) {
+    p_heights[i] = p_heights[col];
+    wall_material_buffer[i] = wall_material_buffer[col];
+  }
+}
+
+void engine_set_ray_step(unsigned char step) {
+  ray_step = step;
+}
+#endif
+
+#if BANKED_ASSETS
+// Ассет материала m — номер m: материалы заносятся в банки первыми и по порядку
+static void fetch_materials(unsigned int needed) {
+  unsigned int loaded = bank_fetch(needed);
+
+  for (unsigned char i = 0; i < NUM_WALL_MATERIALS * WALL_LODS; i++) {
+    if (loaded & (1u << (i / WALL_LODS))) {
+      banked_sprites[i].p_sprite = bank_slot_data(i / WALL_LODS) + banked_offsets[i];
+    }
+  }
+}
+
+// Материалы видимых стен в столбцах, которые нужно перерисовать
+static unsigned int changed_materials() {
+  unsigned int needed = 0;
+
+  for (unsigned char col = 0; col < VIEW_WIDTH; col++) {
+    if (wall_height_buffer[col] > MAX_PROJECTION_HEIGHT) wall_height_buffer[col] = MAX_PROJECTION_HEIGHT;
+    if (wall_height_buffer[col]
+        && (wall_height_buffer[col] != old_wall_height_buffer[col]
+            || wall_material_buffer[col] != old_wall_material_buffer[col])) {
+      needed |= 1u << wall_material_buffer[col];
+    }
+  }
+  return needed;
+}
+#endif
 
 void engine_init() {
+#if defined(SPRITES_PACKED) && !BANKED_ASSETS
+  // Пиксели текстур хранятся сжатыми: распаковываем до всех предвычислений,
+  // которые их читают (кэш масштабированных текстур)
+  for (unsigned char i = 0; i < num_packed_sprites; i++) {
+    lz_unpack(packed_sprites[i].p_packed, packed_sprites[i].p_data);
+  }
+#endif
+
   // Предвычисление таблицы высот в зависимости от дистанции
   calc_distance_deltas();
+#if VIEW_FOV != VIEW_WIDTH
+  calc_view_tables();
+#endif
+#if BANKED_ASSETS
+  calc_banked_sprites();
+#endif
+  calc_material_sprites();
+  calc_object_tables();
+#if FLOOR_DITHER
+  calc_gap_patterns();
+#endif
+#if TRACE_MODE == TRACE_DDA
+  calc_dda_tables();
+#endif
+#if TRACE_ASM
+  calc_trace_tables();
+#endif
+#if PRESCALED_TEXTURES
+  calc_texture_cache();
+#endif
+
+  // Очистка буфера и экрана (на экране могла остаться заставка)
+  memset(pix_buffer, 0x00, PIX_BUFFER_SIZE);
+#if FLOOR_DITHER
+  // Столбцы без стены не перерисовываются, поэтому узор кладётся сразу
+  for (unsigned char i = 0; i < PIX_BUFFER_HEIGHT; i++) {
+    memset(pix_buffer + VIEW_WIDTH * i, gap_patterns[i], VIEW_WIDTH);
+  }
+#endif
+  memset(screen_buf, 0x00, 0x1800);
+  memset(attr_buf, 0x00, ATTR_SCREEN_BUFFER_SIZE);
+
+  // Атрибуты окна задаются один раз: дальше их меняет только
+  // shade_column(). Вокруг узкого окна экран остаётся чёрным.
+  for (unsigned char row = 0; row < PIX_ATTR_BUFFER_HEIGHT; row++) {
+    // Над горизонтом небо, под ним земля
+    memset(attr_buf + VIEW_ATTR_START + row * SCR_WIDTH,
+           row < PIX_ATTR_BUFFER_HEIGHT / 2 ? ATTR_SKY : ATTR_GROUND, VIEW_WIDTH);
+#if ATTR_SHADING
+    memcpy(pix_attr_buffer + row * VIEW_WIDTH, attr_buf + VIEW_ATTR_START + row * SCR_WIDTH, VIEW_WIDTH);
+#endif
+  }
 
-  // Очистка буфера
-  memset(pix_buffer, 0x00, PIX_BUFFER_SIZE);               // Верх: 0–63 строки
+#if DIRTY_BLIT
+  // Первый кадр копируется целиком: экран ещё не совпадает с буфером
+  memset(dirty_top, 0, VIEW_WIDTH);
+#endif
+#if PROFILE_OVERLAY
+  // До init_shadow_screen(): нижняя треть копируется на экран 1
+  profile_init();
+#endif
+#if SHADOW_SCREEN
+  init_shadow_screen();
+#endif
 }
 
 
+// === РЕНДЕРИНГ СТЕН В ОФФСКРИН-БУФЕР ===
+static void draw_walls() {
+  for (unsigned char col = 0; col < VIEW_WIDTH; col++) {
+    if (wall_height_buffer[col] > MAX_PROJECTION_HEIGHT) wall_height_buffer[col] = MAX_PROJECTION_HEIGHT;
+#if BANKED_ASSETS
+    if (wall_height_buffer[col] && !BANK_RESIDENT(wall_material_buffer[col])) continue;
+#endif
+    // Столбец перерисовывается при смене высоты или материала видимой стены
+    if (wall_height_buffer[col] != old_wall_height_buffer[col]
+        || (wall_height_buffer[col] && wall_material_buffer[col] != old_wall_material_buffer[col])) {
+      draw_wall_sprite(col, wall_height_buffer[col], old_wall_height_buffer[col] & ~HEIGHT_STALE, wall_material_buffer[col]);
+      old_wall_height_buffer[col] = wall_height_buffer[col];
+      old_wall_material_buffer[col] = wall_material_buffer[col];
+#if ATTR_SHADING
+      shade_column(col, wall_height_buffer[col], wall_material_buffer[col]);
+#endif
+    }
+  }
+}
+
 void engine_render(int player_x, int player_y, int player_angle) {
 // === ПРОБРОС ЛУЧЕЙ ДЛЯ КАЖДОГО СТОЛБЦА ЭКРАНА ===
   // Переменные для сглаживания краёв стен
@@ -31,18 +407,65 @@ void engine_render(int player_x, int player_y, int player_angle) {
   unsigned char wall_chunk_height;
   unsigned char wall_chunk_size;
   unsigned char wall_height_delta;
+#if TRACE_MODE == TRACE_DDA
+  t_ray_hit hit;
+#endif
+  unsigned char trace_start = 0;
+  unsigned char trace_end = VIEW_WIDTH;
+#if BANKED_ASSETS
+  unsigned int needed;
+#endif
+#if ROTATE_REUSE
+  signed char delta = (unsigned char)player_angle - last_player_angle;
+#endif
 
-  memset(attr_buf, 0b00001100, ATTR_SCREEN_BUFFER_SIZE / 3);           // Верх: 0–63 строки
-  memset(attr_buf + 0x100, 0b00000100, ATTR_SCREEN_BUFFER_SIZE / 3);           // Верх: 0–63 строки
-  
-  for (unsigned char col = 0; col < SCR_WIDTH; col++) {
-      wall_height_buffer[col] = trace_ray(col, player_x, player_y, player_angle);
+  PROFILE_STAGE(STAGE_TRACE);
+#if ROTATE_REUSE
+  // Поворот на месте: уже посчитанные столбцы сдвигаются, трассируются новые
+  if (reuse_valid && RAY_STEP == 1 && player_x == last_player_x && player_y == last_player_y
+      && delta > -VIEW_WIDTH && delta < VIEW_WIDTH) {
+    if (delta > 0) trace_start = shift_columns(delta);
+    else trace_end = shift_columns(delta);
+  }
+  // Интерполированные столбцы не годятся для сдвига: следующий кадр трассирует всё
+  reuse_valid = RAY_STEP == 1;
+  last_player_x = player_x;
+  last_player_y = player_y;
+  last_player_angle = player_angle;
+#define HEIGHT_OUT ray_height_buffer
+#else
+#define HEIGHT_OUT wall_height_buffer
+#endif
+#if COHERENT_TRACE
+  trace_coherent(HEIGHT_OUT, trace_start, trace_end, player_x, player_y, player_angle);
+#else
+  for (unsigned char col = trace_start; col < trace_end; col += RAY_STEP) {
+#if TRACE_MODE == TRACE_DDA
+      trace_ray_dda(col, player_x, player_y, player_angle, &hit);
+      HEIGHT_OUT[col] = hit.height;
+      wall_material_buffer[col] = hit.material;
+#elif TRACE_MODE == TRACE_SKIP
+      HEIGHT_OUT[col] = trace_ray_skip(col, player_x, player_y, player_angle);
+      wall_material_buffer[col] = ray_material;
+#else
+      HEIGHT_OUT[col] = trace_ray(col, player_x, player_y, player_angle);
+      wall_material_buffer[col] = ray_material;
+#endif
     }
+#endif
+#if ADAPTIVE_RES
+    if (ray_step > 1) interpolate_columns(HEIGHT_OUT);
+#endif
+#if ROTATE_REUSE
+    // Сглаживание меняет буфер на месте, поэтому работает с копией
+    memcpy(wall_height_buffer, ray_height_buffer, VIEW_WIDTH);
+#endif
 
     // === СГЛАЖИВАНИЕ КРАЁВ СТЕН (лево → право) ===
+    PROFILE_STAGE(STAGE_SMOOTH_LR);
     wall_chunk_start = 0;
     wall_chunk_height = wall_height_buffer[wall_chunk_start];
-    for (unsigned char col = 0; col < SCR_WIDTH; col++) {
+    for (unsigned char col = 0; col < VIEW_WIDTH; col++) {
       // Прерываем, если достигли края или стена выше (новый объект)
       if (wall_height_buffer[col] == 0 || wall_height_buffer[col] > wall_chunk_height) break;
       // Если высота уменьшилась — сглаживаем линейным градиентом
@@ -60,9 +483,10 @@ void engine_render(int player_x, int player_y, int player_angle) {
     }
 
     // === СГЛАЖИВАНИЕ КРАЁВ СТЕН (право → лево) ===
-    wall_chunk_start = SCR_WIDTH - 1;
+    PROFILE_STAGE(STAGE_SMOOTH_RL);
+    wall_chunk_start = VIEW_WIDTH - 1;
     wall_chunk_height = wall_height_buffer[wall_chunk_start];
-    for (unsigned char col = SCR_WIDTH - 1; col > 0; col--) {
+    for (unsigned char col = VIEW_WIDTH - 1; col > 0; col--) {
       if (wall_height_buffer[col] == 0 || wall_height_buffer[col] > wall_chunk_height) break;
       if (wall_height_buffer[col] < wall_chunk_height) {
         wall_chunk_size = wall_chunk_start - col;
@@ -76,16 +500,31 @@ void engine_render(int player_x, int player_y, int player_angle) {
     }
 
     // === РЕНДЕРИНГ СТЕН В ОФФСКРИН-БУФЕР ===
-    for (unsigned char col = 0; col < SCR_WIDTH; col++) {
-      if (wall_height_buffer[col] > MAX_PROJECTION_HEIGHT) wall_height_buffer[col] = MAX_PROJECTION_HEIGHT;
-      if (wall_height_buffer[col] != old_wall_height_buffer[col]) {
-        draw_wall_sprite(col, wall_height_buffer[col], old_wall_height_buffer[col]);
-        old_wall_height_buffer[col] = wall_height_buffer[col];
-      }
+    PROFILE_STAGE(STAGE_DRAW);
+#if BANKED_ASSETS
+    // Проход рисует столбцы, материал которых в слоте; следующий — остальные
+    while ((needed = changed_materials()) != 0) {
+      fetch_materials(needed);
+      draw_walls();
     }
+#else
+    draw_walls();
+#endif
+
+    // === ОБЪЕКТЫ ПОВЕРХ СТЕН ===
+    PROFILE_STAGE(STAGE_OBJECTS);
+    draw_objects(player_x, player_y, player_angle);
 
     // === КОПИРОВАНИЕ БУФЕРА НА ЭКРАН ===
+    PROFILE_STAGE(STAGE_COPY);
+#if SHADOW_SCREEN
+    flip_screens();
+#elif DIRTY_BLIT
+    copy_dirty_pix_buf();
+#else
     copy_pix_buf();
+#endif
+    PROFILE_STAGE(STAGE_COUNT);
 }
 
 // === КОПИРОВАНИЕ ОФФСКРИН-БУФЕРА НА ЭКРАН ===
@@ -94,33 +533,256 @@ void copy_pix_buf() {
 
   // Копируем каждую строку буфера в соответствующую строку экрана
   for (unsigned char i = 0; i < PIX_BUFFER_HEIGHT; i++) {
-    memcpy(screen_line_addrs[i], p_buf, SCR_WIDTH);
-    p_buf += SCR_WIDTH;
+    memcpy(VIEW_LINE(i), p_buf, VIEW_WIDTH);
+    p_buf += VIEW_WIDTH;
   }
 
 }
 
+#if DIRTY_BLIT
+// === КОПИРОВАНИЕ ТОЛЬКО ИЗМЕНЁННЫХ СТОЛБЦОВ ===
+void copy_dirty_pix_buf() {
+  unsigned char col, run_start, top;
+  unsigned char dirty_count = 0;
+
+  for (col = 0; col < VIEW_WIDTH; col++) {
+    if (dirty_top[col] < DIRTY_CLEAN) dirty_count++;
+  }
+  if (dirty_count == 0) return;
+
+  if (dirty_count > DIRTY_BLIT_MAX_COLUMNS) {
+    // Изменилась большая часть экрана — быстрее скопировать всё подряд
+    copy_pix_buf();
+  } else {
+    // Соседние изменённые столбцы объединяются в полосы с общим диапазоном строк
+    col = 0;
+    while (col < VIEW_WIDTH) {
+      if (dirty_top[col] >= DIRTY_CLEAN) {
+        col++;
+        continue;
+      }
+      run_start = col;
+      top = dirty_top[col];
+      while (++col < VIEW_WIDTH && dirty_top[col] < DIRTY_CLEAN) {
+        if (dirty_top[col] < top) top = dirty_top[col];
+      }
+      copy_pix_run(run_start, col - run_start, top);
+    }
+  }
+
+  memset(dirty_top, DIRTY_CLEAN, VIEW_WIDTH);
+}
+
+#ifdef __SDCC
+// Параметры развёрнутого копирования (передаются через память, чтобы не
+// зависеть от соглашения о вызовах конкретной версии SDCC)
+static char *blit_dst;
+static const char *blit_src;
+static unsigned char blit_len;
+
+// Копирует blit_len (1–32) байт цепочкой LDI: вход в середину развёрнутой
+// цепочки вместо LDIR экономит 5 тактов на байт
+static void blit_ldi() __naked {
+  __asm
+    ld a, (_blit_len)
+    add a, a
+    neg
+    ld c, a
+    ld b, #0xff                 ; BC = -2 * len (длина команды LDI — 2 байта)
+    ld hl, #00001$
+    add hl, bc
+    push hl                     ; Адрес входа в цепочку
+    ld hl, (_blit_src)
+    ld de, (_blit_dst)
+    ret
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+    ldi
+00001$:
+    ret
+  __endasm;
+}
+#endif
+
+// === КОПИРОВАНИЕ ПОЛОСЫ СТОЛБЦОВ [col, col + width) В СТРОКАХ [top, PIX_BUFFER_HEIGHT - top) ===
+void copy_pix_run(unsigned char col, unsigned char width, unsigned char top) {
+  char *p_buf = pix_buffer + (VIEW_WIDTH * top) + col;
+
+  for (unsigned char i = top; i < PIX_BUFFER_HEIGHT - top; i++) {
+#ifdef __SDCC
+    blit_dst = VIEW_LINE(i) + col;
+    blit_src = p_buf;
+    blit_len = width;
+    blit_ldi();
+#else
+    memcpy(VIEW_LINE(i) + col, p_buf, width);
+#endif
+    p_buf += VIEW_WIDTH;
+  }
+}
+
+// Отметка изменённых строк столбца: [top, PIX_BUFFER_HEIGHT - top)
+#define MARK_DIRTY(x, top) if ((top) < dirty_top[x]) dirty_top[x] = (top)
+#else
+#define MARK_DIRTY(x, top)
+#endif
+
+#if SHADOW_SCREEN
+// Столбец рисуется сразу в задний экран: строки экрана идут не подряд,
+// поэтому переход на следующую строку — по таблице адресов
+#define COLUMN_START(row) p_line = back_lines + (row)
+#define COLUMN_PUT(value) *(*p_line++ + x) = (value)
+#else
+#define COLUMN_START(row) p_buf = pix_buffer + ((VIEW_WIDTH * (row)) + x)
+#define COLUMN_PUT(value) *p_buf = (value); p_buf += VIEW_WIDTH   // Переход на следующую строку (внутри столбца)
+#endif
+
+
+#if ROTATE_REUSE
+// === СДВИГ ГОТОВЫХ СТОЛБЦОВ ПРИ ПОВОРОТЕ НА delta (0 < |delta| < 32) ===
+// Возвращает границу столбцов, которые нужно трассировать заново: при
+// delta > 0 это [результат, 32), при delta < 0 — [0, результат).
+// Открывшиеся столбцы pix_buffer не трогаются: в них остаётся прежнее
+// изображение с прежней высотой, и рисование обновит их как обычно.
+unsigned char shift_columns(signed char delta) {
+  unsigned char count, dst, src, top, x;
+  unsigned char max_height = 0;
+  unsigned char shift = delta > 0 ? delta : -delta;
+  char *p_row;
+
+  count = VIEW_WIDTH - shift;
+  dst = delta > 0 ? 0 : shift;
+  src = delta > 0 ? shift : 0;
+
+  memmove(ray_height_buffer + dst, ray_height_buffer + src, count);
+  memmove(wall_material_buffer + dst, wall_material_buffer + src, count);
+
+  // Сдвигаются только строки, где хоть один столбец не пуст
+  for (x = 0; x < VIEW_WIDTH; x++) {
+    if ((old_wall_height_buffer[x] & ~HEIGHT_STALE) > max_height) max_height = old_wall_height_buffer[x] & ~HEIGHT_STALE;
+  }
+  top = (PIX_BUFFER_HEIGHT / 2) - max_height;
+  p_row = pix_buffer + (VIEW_WIDTH * top);
+  for (unsigned char i = top; i < PIX_BUFFER_HEIGHT - top; i++) {
+    memmove(p_row + dst, p_row + src, count);
+    p_row += VIEW_WIDTH;
+  }
+
+  // Текстура выбирается по x % width: при сдвиге, не кратном ширине
+  // спрайта, столбец нужно перерисовать даже при той же высоте
+  memmove(old_wall_height_buffer + dst, old_wall_height_buffer + src, count);
+  memmove(old_wall_material_buffer + dst, old_wall_material_buffer + src, count);
+  for (x = dst; x < dst + count; x++) {
+    if (old_wall_height_buffer[x] & ~HEIGHT_STALE) {
+      if (shift % material_sprites[old_wall_material_buffer[x]][old_wall_height_buffer[x] & ~HEIGHT_STALE]->width) old_wall_height_buffer[x] |= HEIGHT_STALE;
+    }
+    MARK_DIRTY(x, top);
+#if ATTR_SHADING
+    // Атрибуты не сдвигаются вместе с пикселями: пересчёт по сдвинутой высоте
+    shade_column(x, old_wall_height_buffer[x] & ~HEIGHT_STALE, old_wall_material_buffer[x]);
+#endif
+  }
+
+  return delta > 0 ? count : shift;
+}
+#endif
+
+#if ATTR_SHADING
+static const unsigned char material_inks[NUM_WALL_MATERIALS] = {
+  4,  // Зрелая кукуруза: зелёный
+  6,  // Созревающая: жёлтый
+  5   // Молодая: голубой
+};
+
+#if SHADOW_SCREEN
+// Атрибуты заднего экрана сами служат копией для сравнения
+#define ATTR_MIRROR (back_attrs + VIEW_ATTR_START)
+#define ATTR_MIRROR_WIDTH SCR_WIDTH
+#define ATTR_SCREEN (back_attrs + VIEW_ATTR_START)
+#else
+#define ATTR_MIRROR pix_attr_buffer
+#define ATTR_MIRROR_WIDTH VIEW_WIDTH
+#define ATTR_SCREEN (attr_buf + VIEW_ATTR_START)
+#endif
+
+// === АТРИБУТЫ СТОЛБЦА ПО ВЫСОТЕ И МАТЕРИАЛУ СТЕНЫ ===
+void shade_column(unsigned char x, unsigned char height, unsigned char material) {
+  char *p_mirror = ATTR_MIRROR + x;
+  char *p_attr = ATTR_SCREEN + x;
+  unsigned char ink, attr;
+  // Знакоместа окна, задетые стеной: строки [горизонт - height, горизонт + height)
+  unsigned char top = ((PIX_BUFFER_HEIGHT / 2) - height) >> 3;
+  unsigned char bottom = ((PIX_BUFFER_HEIGHT / 2) + height + 7) >> 3;
+
+  if (height > SHADE_NEAR_HEIGHT) ink = material_inks[material] | ATTR_BRIGHT;
+  else if (height > SHADE_FAR_HEIGHT) ink = material_inks[material];
+  else ink = SHADE_FOG_INK;
+
+  for (unsigned char row = 0; row < PIX_ATTR_BUFFER_HEIGHT; row++) {
+    attr = row < PIX_ATTR_BUFFER_HEIGHT / 2 ? ATTR_SKY : ATTR_GROUND;
+    if (height && row >= top && row < bottom) attr = (attr & ATTR_PAPER_MASK) | ink;
+    // В экранную память пишутся только изменившиеся ячейки
+    if (*p_mirror != attr) {
+      *p_mirror = attr;
+      *p_attr = attr;
+    }
+    p_mirror += ATTR_MIRROR_WIDTH;
+    p_attr += SCR_WIDTH;
+  }
+}
+#endif
+
 // === РИСОВАНИЕ ТЕКСТУРЫ СТЕНЫ ===
-void draw_wall_sprite(unsigned char x, unsigned char height, unsigned char old_height) {
+void draw_wall_sprite(unsigned char x, unsigned char height, unsigned char old_height, unsigned char material) {
   unsigned char y, old_y;
+#if SHADOW_SCREEN
+  char **p_line;
+#else
   char *p_buf;
+#endif
   unsigned char width;
-  const t_sprite *p_sprite_descriptor;
   const char *p_sprite_data;
+#if !PRESCALED_TEXTURES
+  const t_sprite *p_sprite_descriptor;
   const char *p_attr_data;
+#endif
   
-  // Выбор текстуры в зависимости от высоты стены
-  if (height <= 4) {
-    p_sprite_descriptor = &corn_mature_0;  // 8 пикселей
-  } else if (height <= 8) {
-    p_sprite_descriptor = &corn_mature_1;  // 16
-  } else if (height <= 16) {
-    p_sprite_descriptor = &corn_mature_2;  // 32Local (1)
-  } else if (height <= 32) {
-    p_sprite_descriptor = &corn_mature_3;  // 64
-  } else {
-    p_sprite_descriptor = &corn_mature_4;  // Полная 128-пиксельная текстура
-  }
+#if PRESCALED_TEXTURES
+  // Столбец нужной высоты читается подряд
+  p_sprite_data = textures[height].p_data + (x % textures[height].width) * textures[height].rows;
+  width = 1;
+#else
+  // Спрайт по материалу и высоте — одно обращение к таблице
+  p_sprite_descriptor = material_sprites[material][height];
 
   width = p_sprite_descriptor->width;
   
@@ -129,50 +791,342 @@ void draw_wall_sprite(unsigned char x, unsigned char height, unsigned char old_h
 
   p_attr_data = p_sprite_descriptor->p_attributes;
   p_attr_data += x % p_sprite_descriptor->width;
+#endif
 
   
-  // Вертикальная позиция: центрирование относительно середины буфера (64)
+  // Вертикальная позиция: центрирование относительно середины буфера (горизонта)
   y = (PIX_BUFFER_HEIGHT / 2) - height;
   old_y = (PIX_BUFFER_HEIGHT / 2) - old_height;
+  MARK_DIRTY(x, y < old_y ? y : old_y);
 
   
+  // Строки, которые стена освободила, заливаются фоном (нулём или узором строки)
   if (y > old_y) {
-    p_buf = pix_buffer + ((SCR_WIDTH * old_y) + x);
-    for (unsigned char i = 0; i < (y - old_y); i++) {
-      *p_buf = 0x00;
-      p_buf += SCR_WIDTH;   // Переход на следующую строку (внутри столбца)
+    COLUMN_START(old_y);
+    for (unsigned char i = old_y; i < y; i++) {
+      COLUMN_PUT(GAP_BYTE(i));
     }
   } else {
-    p_buf = pix_buffer + ((SCR_WIDTH * y) + x);
+    COLUMN_START(y);
   }
+#if COMPILED_COLUMNS
+  // Развёрнутая запись столбца, сгенерированная экстрактором
+  if (p_sprite_descriptor->p_columns) {
+    p_sprite_descriptor->p_columns[x % width](p_buf, height * 2);
+    p_buf += VIEW_WIDTH * (height * 2);
+  } else
+#endif
   for (unsigned char i = 0; i < (height * 2); i++) {
-    *p_buf = *p_sprite_data;
-    p_buf += SCR_WIDTH;   // Переход на следующую строку (внутри столбца)
+    COLUMN_PUT(*p_sprite_data);
     p_sprite_data += width;
   }
 
   if (y > old_y) {
-    for (unsigned char i = 0; i < (y - old_y); i++) {
-      *p_buf = 0x00;
-      p_buf += SCR_WIDTH;   // Переход на следующую строку (внутри столбца)
+    for (unsigned char i = PIX_BUFFER_HEIGHT - y; i < PIX_BUFFER_HEIGHT - old_y; i++) {
+      COLUMN_PUT(GAP_BYTE(i));
+    }
+  }
+}
+
+// === ОБЪЕКТЫ (BILLBOARD) ===
+void objects_clear() {
+  num_objects = 0;
+}
+
+unsigned char object_add(int x, int y, unsigned char material) {
+  if (num_objects == MAX_OBJECTS) return OBJECT_NONE;
+  objects[num_objects].x = x;
+  objects[num_objects].y = y;
+  objects[num_objects].material = material;
+  return num_objects++;
+}
+
+void object_move(unsigned char id, int x, int y) {
+  objects[id].x = x;
+  objects[id].y = y;
+}
+
+// Проекция объекта: шаг луча d (или OBJECT_NONE, если объект не виден),
+// левый столбец и полувысота стены на этой дистанции
+static unsigned char project_object(const t_object *p_object, unsigned char id,
+                                    int player_x, int player_y, int player_angle) {
+  int sin = SIN(player_angle);
+  int cos = COS(player_angle);
+  int dx = p_object->x - player_x;
+  int dy = p_object->y - player_y;
+  long fwd, side, tan;
+  unsigned char offset, d, height, width;
+  signed char center;
+
+  // Координаты в системе камеры (в 1/256 клетки, умноженные на 127)
+  fwd = (long)dx * cos + (long)dy * sin;
+  side = (long)dy * cos - (long)dx * sin;
+  if (fwd <= 0) return OBJECT_NONE;
+
+  // Столбец центра: угол от направления взгляда
+  tan = ((side < 0 ? -side : side) * 64) / fwd;
+  if (tan > OBJECT_MAX_TAN) return OBJECT_NONE;
+  offset = object_tan_offsets[tan];
+  center = (VIEW_WIDTH / 2) + (side < 0 ? -(signed char)ANGLE_COLUMNS(offset) : (signed char)ANGLE_COLUMNS(offset));
+
+  // Шаг луча до центра: длина шага 127/256 клетки, дистанция вдоль луча — fwd / cos(offset)
+  fwd /= 127;
+  d = (fwd * 2 + COS(offset)) / (2 * COS(offset));
+  if (d >= MAX_DISTANCE) return OBJECT_NONE;
+
+  height = hit_heights[d];
+  if (height > MAX_PROJECTION_HEIGHT) height = MAX_PROJECTION_HEIGHT;
+  if (height < 2) return OBJECT_NONE;
+
+  // Ширина по высоте спрайта (height пикселей), не меньше одного столбца
+  width = (height + 7) >> 3;
+  object_left[id] = center - (width >> 1);
+  object_height[id] = height;
+  if (object_left[id] >= VIEW_WIDTH || object_left[id] + width <= 0) return OBJECT_NONE;
+  return d;
+}
+
+// Рисует видимые столбцы объекта id: там, где стена дальше объекта
+static void draw_object(unsigned char id) {
+  unsigned char height = object_height[id];
+  unsigned char sprite_height = height >> 1;   // Объект — половина стены, стоит на полу
+  unsigned char width = (height + 7) >> 3;
+  unsigned char y = (PIX_BUFFER_HEIGHT / 2) + height - sprite_height * 2;
+  const t_sprite *p_sprite = material_sprites[objects[id].material][sprite_height];
+  const char *p_sprite_data;
+  signed char left = object_left[id];
+  unsigned char x, u;
+#if SHADOW_SCREEN
+  char **p_line;
+#else
+  char *p_buf;
+#endif
+
+#if BANKED_ASSETS
+  if (!BANK_RESIDENT(objects[id].material)) fetch_materials(1u << objects[id].material);
+#endif
+  for (u = 0; u < width; u++) {
+    if (left + (signed char)u < 0) continue;
+    x = left + u;
+    if (x >= VIEW_WIDTH) break;
+    // Буфер глубины: стена той же или большей высоты ближе объекта
+    if (wall_height_buffer[x] >= height) continue;
+
+    // Нижние строки текстуры: у объекта на полу видны стебли, а не верхушки
+    p_sprite_data = p_sprite->p_sprite + (p_sprite->height * 8 - sprite_height * 2) * p_sprite->width
+                  + u % p_sprite->width;
+    // Грязный диапазон симметричен относительно середины: верх — как у стены той же высоты
+    MARK_DIRTY(x, (PIX_BUFFER_HEIGHT / 2) - height);
+    COLUMN_START(y);
+    for (unsigned char i = 0; i < sprite_height * 2; i++) {
+      COLUMN_PUT(*p_sprite_data);
+      p_sprite_data += p_sprite->width;
     }
+    // Следующий кадр перерисует столбец стены и сотрёт объект до его высоты
+    old_wall_height_buffer[x] = height | HEIGHT_STALE;
   }
 }
 
+// === РИСОВАНИЕ ОБЪЕКТОВ ===
+// Проекции раскладываются по корзинам шага луча и рисуются от дальних к
+// ближним. Объект, все столбцы которого закрыты стенами, отбрасывается до
+// работы с пикселями.
+void draw_objects(int player_x, int player_y, int player_angle) {
+  unsigned char id, d, x, width, visible;
+  signed char left;
+
+  memset(object_buckets, OBJECT_NONE, MAX_DISTANCE);
+  for (id = 0; id < num_objects; id++) {
+    d = project_object(&objects[id], id, player_x, player_y, player_angle);
+    if (d == OBJECT_NONE) continue;
+
+    // Отсечение по буферу глубины: есть ли столбец, где стена дальше
+    left = object_left[id];
+    width = (object_height[id] + 7) >> 3;
+    visible = 0;
+    for (x = left < 0 ? 0 : left; x < VIEW_WIDTH && (signed char)x < left + width; x++) {
+      if (wall_height_buffer[x] < object_height[id]) {
+        visible = 1;
+        break;
+      }
+    }
+    if (!visible) continue;
+
+    object_next[id] = object_buckets[d];
+    object_buckets[d] = id;
+  }
+
+  d = MAX_DISTANCE;
+  while (d--) {
+    for (id = object_buckets[d]; id != OBJECT_NONE; id = object_next[id]) {
+      draw_object(id);
+    }
+  }
+}
+
+#if TRACE_ASM
+#ifdef __SDCC
+// === ЯДРО МАРША ЛУЧА ===
+// Основной набор: DE = x, BC = cos, HL — указатель в таблицы; альтернативный:
+// DE' = y, BC' = sin, HL' — указатель в карту. A' — оставшиеся шаги.
+// Обработчик прерывания альтернативный набор не трогает. Шаг — 154 такта.
+// EX AF,AF' записан байтом: апостроф в __asm ломает препроцессор.
+static void trace_march() __naked {
+  __asm
+    ld de, (_trace_x)
+    ld bc, (_trace_cos)
+    exx
+    ld de, (_trace_y)
+    ld bc, (_trace_sin)
+    exx
+    ld a, (_trace_steps)
+00001$:
+    .db 0x08                    ; EX AF, AF (альт.): счётчик шагов уходит в альтернативный A
+    ld l, d                     ; Старший байт X
+    ld h, #(TRACE_COLS_START >> 8)
+    ld a, (hl)                  ; Смещение клетки в строке
+    inc h                       ; HL -> маска клетки (TRACE_MASKS_START)
+    exx
+    ld l, d                     ; Старший байт Y
+    ld h, #(TRACE_ROWS_START >> 8)
+    or a, (hl)                  ; + младший байт адреса строки (без переноса)
+    inc h
+    ld h, (hl)                  ; Старший байт адреса строки (TRACE_ROWS_HI_START)
+    ld l, a
+    ld a, (hl)                  ; Байт карты
+    exx
+    and a, (hl)
+    jr nz, 00002$
+    ex de, hl                   ; x += cos
+    add hl, bc
+    ex de, hl
+    exx
+    ex de, hl                   ; y += sin
+    add hl, bc
+    ex de, hl
+    exx
+    .db 0x08                    ; EX AF, AF (альт.)
+    dec a
+    jr nz, 00001$
+    ld a, #MAX_DISTANCE         ; Стена слишком далеко (невидима)
+    ld (_trace_hit_step), a
+    ret
+00002$:
+    ld a, d
+    ld (_trace_cell_x), a
+    exx
+    ld a, d
+    ld (_trace_cell_y), a
+    exx
+    .db 0x08                    ; EX AF, AF (альт.)
+    ld b, a                     ; Оставшиеся шаги, включая текущий
+    ld a, (_trace_steps)
+    sub a, b
+    ld (_trace_hit_step), a
+    ret
+  __endasm;
+}
+#else
+// Си-модель ядра для хоста: те же таблицы и тот же порядок проверок
+static void trace_march() {
+  unsigned int x = trace_x;
+  unsigned int y = trace_y;
+  unsigned char left = trace_steps;
+  unsigned char cx, cy;
+  unsigned int addr;
+
+  do {
+    cx = x >> 8;
+    cy = y >> 8;
+    addr = ((unsigned int)trace_rows_hi[cy] << 8) | (trace_rows[cy] | trace_cols[cx]);
+    if (map_packed[addr - MAP_PACKED_START] & trace_masks[cx]) {
+      trace_cell_x = cx;
+      trace_cell_y = cy;
+      trace_hit_step = trace_steps - left;
+      return;
+    }
+    x += trace_cos;
+    y += trace_sin;
+  } while (--left);
+  trace_hit_step = MAX_DISTANCE;
+}
+#endif
+
+// === ПРОБРОС ЛУЧА (ЯДРО НА АССЕМБЛЕРЕ) ===
+// Результат совпадает с Си-версией бит в бит, включая ray_material при промахе
+unsigned char trace_ray(int angle, int player_x, int player_y, int player_angle) {
+  unsigned char eff_angle = (RAY_ANGLE(angle) + player_angle) & 0xff;
+
+  trace_x = player_x;
+  trace_y = player_y;
+  trace_cos = COS(eff_angle);
+  trace_sin = SIN(eff_angle);
+  trace_march();
+  if (trace_hit_step == MAX_DISTANCE) {
+#if COHERENT_TRACE
+    ray_cell = RAY_CELL_NONE;
+#endif
+    return 0;
+  }
+  ray_material = MAP_CELL_AT(trace_cell_x, trace_cell_y) - 1;
+#if COHERENT_TRACE
+  ray_cell = ((unsigned int)trace_cell_y << 8) | trace_cell_x;
+  ray_hit_step = trace_hit_step;
+#endif
+  return hit_heights[trace_hit_step];
+}
+
+// === ПРЕДВЫЧИСЛЕНИЕ ТАБЛИЦ ЯДРА МАРША ===
+void calc_trace_tables() {
+  unsigned char i = 0, d = 0;
+  unsigned int row;
+  unsigned int ray = INIT_WALL_HEIGHT;
+
+  // Все 256 значений байта: за пределы карты луч не выходит (она замкнута
+  // стенами), но и там сумма младших байтов не даёт переноса
+  do {
+    trace_cols[i] = (i >> MAP_X_SHIFT) & ((1 << MAP_ROW_SHIFT) - 1);
+    trace_masks[i] = map_cell_masks[i & MAP_X_MASK];
+    row = MAP_PACKED_START + ((unsigned int)(i < MAP_HEIGHT ? i : 0) << MAP_ROW_SHIFT);
+    trace_rows[i] = row & 0xff;
+    trace_rows_hi[i] = row >> 8;
+  } while (++i);
+
+  // Си-версия проверяет карту на шаге d, пока высота луча не меньше
+  // distance_deltas[d]; последняя дельта больше любой высоты
+  while (ray >= distance_deltas[d]) ray -= distance_deltas[d++];
+  trace_steps = d + 1;
+}
+#else
 // === ПРОБРОС ЛУЧА ===
 unsigned char trace_ray(int angle, int player_x, int player_y, int player_angle) {
   // Вычисление абсолютного угла луча с учётом направления взгляда и смещения по экрану
-  int eff_angle = (angle + player_angle - (SCR_WIDTH / 2)) & 0xff;
-  int ray = INIT_WALL_HEIGHT;  // Начальная "высота" луча (в фиксированной точке)
+  int eff_angle = (RAY_ANGLE(angle) + player_angle) & 0xff;
+  unsigned int ray = INIT_WALL_HEIGHT;  // Начальная "высота" луча (в фиксированной точке)
   int sin = SIN(eff_angle);
   int cos = COS(eff_angle);
   int x = player_x;
   int y = player_y;
 
-  const int *p_delta = distance_deltas;
+  const unsigned int *p_delta = distance_deltas;
+  unsigned char cell_x, cell_y;
+  unsigned char cell = 0;
+
+#if COHERENT_TRACE
+  ray_cell = RAY_CELL_NONE;
+#endif
 
   // Пошаговое продвижение луча
-  for (unsigned char d = 0; d < MAX_DISTANCE && get_map_at(x, y) == 0; d++) {
+  for (unsigned char d = 0; d < MAX_DISTANCE; d++) {
+    cell_x = x >> 8;
+    cell_y = y >> 8;
+    cell = MAP_WALL_AT(cell_x, cell_y);
+    if (cell) {
+#if COHERENT_TRACE
+      ray_hit_step = d;
+#endif
+      break;
+    }
     // Если "высота" луча упала ниже порога — стена слишком далеко (невидима)
     if (ray < *p_delta) return 0;
     ray -= *p_delta;  // Уменьшаем высоту на дельту для текущей дистанции
@@ -181,25 +1135,158 @@ unsigned char trace_ray(int angle, int player_x, int player_y, int player_angle)
     p_delta++;
   }
 
+  // Материал извлекается из байта карты только для попадания
+  ray_material = cell ? MAP_CELL_AT(cell_x, cell_y) - 1 : 0;
+#if COHERENT_TRACE
+  ray_cell = cell ? ((unsigned int)cell_y << 8) | cell_x : RAY_CELL_NONE;
+#endif
+
   // Преобразуем высоту из фиксированной точки в пиксели
   ray = ray >> 8;
   return (unsigned char)ray;
 }
+#endif
+
+#if TRACE_MODE == TRACE_SKIP
+// === ПРОБРОС ЛУЧА С ПРОПУСКОМ ПУСТОГО ПРОСТРАНСТВА ===
+// Шаги те же, что в trace_ray(), поэтому и высоты совпадают бит в бит.
+// Вокруг пустой клетки с расстоянием D до стены квадрат (2D - 1) клеток
+// пуст: пока луч внутри него, карта не читается.
+unsigned char trace_ray_skip(int angle, int player_x, int player_y, int player_angle) {
+  int eff_angle = (RAY_ANGLE(angle) + player_angle) & 0xff;
+  int sin = SIN(eff_angle);
+  int cos = COS(eff_angle);
+  int x = player_x;
+  int y = player_y;
+  unsigned char d = 0;
+  unsigned char cell_x, cell_y, dist, span;
+
+  for (;;) {
+    cell_x = x >> 8;
+    cell_y = y >> 8;
+    dist = map_dist[cell_y][cell_x];
+    if (dist == 0) {
+      ray_material = MAP_CELL_AT(cell_x, cell_y) - 1;
+#if COHERENT_TRACE
+      ray_cell = ((unsigned int)cell_y << 8) | cell_x;
+      ray_hit_step = d;
+#endif
+      return hit_heights[d];
+    }
+
+    // Левый верхний угол пустого квадрата и его сторона
+    cell_x -= dist - 1;
+    cell_y -= dist - 1;
+    span = 2 * dist - 1;
+    do {
+      // Последний шаг марша: стена слишком далеко (невидима)
+      if (d == MAX_DISTANCE - 1) {
+#if COHERENT_TRACE
+        ray_cell = RAY_CELL_NONE;
+#endif
+        return 0;
+      }
+      d++;
+      x += cos;
+      y += sin;
+    } while ((unsigned char)((x >> 8) - cell_x) < span && (unsigned char)((y >> 8) - cell_y) < span);
+  }
+}
+#endif
+
+#if TRACE_MODE == TRACE_DDA
+// === ПРОБРОС ЛУЧА ПО ГРАНИЦАМ КЛЕТОК (DDA) ===
+void trace_ray_dda(unsigned char col, int player_x, int player_y, int player_angle, t_ray_hit *p_hit) {
+  unsigned char eff_angle = (RAY_ANGLE(col) + player_angle) & 0xff;
+  int sin = SIN(eff_angle);
+  int cos = COS(eff_angle);
+  unsigned char map_x = player_x >> 8;
+  unsigned char map_y = player_y >> 8;
+  // Длина луча (8.8) на пересечение одной клетки по X и по Y
+  unsigned int delta_x = ray_recip[cos < 0 ? -cos : cos];
+  unsigned int delta_y = ray_recip[sin < 0 ? -sin : sin];
+  unsigned int side_x, side_y, dist, perp;
+  signed char step_x, step_y;
+  unsigned char frac;
+  int offset;
+
+  // Расстояние вдоль луча до первой границы клетки по каждой оси. Вдоль оси,
+  // к которой луч параллелен, — DDA_NO_CROSSING: выбранная граница ближе
+  // DDA_MAX_DISTANCE, и после прибавки шага (не больше 127 * 256) другая ось
+  // остаётся меньше стража, поэтому эта ось никогда не выбирается и не растёт
+  if (cos == 0) {
+    step_x = 0;
+    side_x = DDA_NO_CROSSING;
+  } else if (cos < 0) {
+    step_x = -1;
+    frac = player_x & 0xff;
+    side_x = ((unsigned long)frac * delta_x) >> 8;
+  } else {
+    step_x = 1;
+    frac = player_x & 0xff;
+    side_x = ((unsigned long)(256 - frac) * delta_x) >> 8;
+  }
+  if (sin == 0) {
+    step_y = 0;
+    side_y = DDA_NO_CROSSING;
+  } else if (sin < 0) {
+    step_y = -1;
+    frac = player_y & 0xff;
+    side_y = ((unsigned long)frac * delta_y) >> 8;
+  } else {
+    step_y = 1;
+    frac = player_y & 0xff;
+    side_y = ((unsigned long)(256 - frac) * delta_y) >> 8;
+  }
+
+  // Переход от границы к границе: одно обращение к карте на клетку
+  for (;;) {
+    if (side_x < side_y) {
+      dist = side_x;
+      side_x += delta_x;
+      map_x += step_x;
+      p_hit->side = 0;
+    } else {
+      dist = side_y;
+      side_y += delta_y;
+      map_y += step_y;
+      p_hit->side = 1;
+    }
+    if (dist >= DDA_MAX_DISTANCE) {
+      p_hit->height = 0;
+      p_hit->material = 0;
+      p_hit->u = 0;
+      p_hit->distance = DDA_MAX_DISTANCE;
+      return;
+    }
+    if (MAP_WALL_AT(map_x, map_y)) break;
+  }
+  p_hit->material = MAP_CELL_AT(map_x, map_y) - 1;
+
+  // Координата попадания вдоль грани: dist * sin / 127 (258 / 32768 ≈ 1 / 127)
+  if (p_hit->side == 0) {
+    offset = ((long)dist * sin * 258) >> 15;
+    p_hit->u = (player_y + offset) & 0xff;
+    if (step_x > 0) p_hit->u = 255 - p_hit->u;
+  } else {
+    offset = ((long)dist * cos * 258) >> 15;
+    p_hit->u = (player_x + offset) & 0xff;
+    if (step_y < 0) p_hit->u = 255 - p_hit->u;
+  }
 
-// === ПОЛУЧЕНИЕ ЗНАЧЕНИЯ КАРТЫ ===
-char get_map_at(unsigned int x, unsigned int y) {
-  // Преобразуем фиксированные координаты (8.8) в индексы карты (целые)
-  unsigned char mapX = (x >> 8) & 0xff;
-  unsigned char mapY = (y >> 8) & 0xff;
-  return map[mapY][mapX];
+  // Перпендикулярная дистанция убирает искажение «рыбий глаз»
+  perp = ((unsigned long)dist * ray_fisheye[col]) >> 8;
+  p_hit->distance = perp;
+  p_hit->height = dda_heights[perp >> DDA_HEIGHT_SHIFT];
 }
+#endif
 
 // === УСТАНОВКА ОТДЕЛЬНОГО ПИКСЕЛЯ (НЕ ИСПОЛЬЗУЕТСЯ В ОСНОВНОМ ЦИКЛЕ) ===
 void pixel(unsigned char x, unsigned char y) {
   unsigned char coarse_x = x / 8;   // Байт в строке
   unsigned char fine_x = x % 8;     // Бит внутри байта
   // Устанавливаем бит (ZX Spectrum: старший бит = левый пиксель)
-  pix_buffer[y * SCR_WIDTH + coarse_x] |= 0x80 >> fine_x;
+  pix_buffer[y * VIEW_WIDTH + coarse_x] |= 0x80 >> fine_x;
 }
 
 // === ПРЕДВЫЧИСЛЕНИЕ ТАБЛИЦЫ ВЫСОТ ПО ДИСТАНЦИИ ===
@@ -213,4 +1300,189 @@ void calc_distance_deltas() {
   }
   distance_deltas[0] = 0;                     // Нулевая дистанция — нет изменения
   distance_deltas[MAX_DISTANCE - 1] = 10000;  // Последнее значение — большое число (стена "бесконечно" далеко)
+
+  // Высота, которую trace_ray() вернул бы при стене на шаге d (для
+  // TRACE_SKIP и для проекции объектов)
+  old_height = INIT_WALL_HEIGHT;
+  for (unsigned char d = 0; d < MAX_DISTANCE; d++) {
+    hit_heights[d] = old_height >> 8;
+    old_height -= distance_deltas[d];
+  }
+}
+
+#if VIEW_FOV != VIEW_WIDTH
+// === УГЛЫ ЛУЧЕЙ СТОЛБЦОВ ===
+// VIEW_FOV единиц угла на VIEW_WIDTH столбцов: угол столбца col —
+// col * VIEW_FOV / VIEW_WIDTH от левого края поля зрения
+void calc_view_tables() {
+  for (unsigned char col = 0; col < VIEW_WIDTH; col++) {
+    ray_angles[col] = (col * VIEW_FOV) / VIEW_WIDTH - (VIEW_FOV / 2);
+  }
+}
+#endif
+
+#if FLOOR_DITHER
+// === УЗОРЫ ПОЛА И ПОТОЛКА ===
+// Строка k от горизонта видит пол на дистанции ~1/k, поэтому уровень
+// дизеринга растёт линейно от горизонта к краю буфера
+void calc_gap_patterns() {
+  static const unsigned char bayer[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+  };
+  unsigned char level, pattern;
+
+  for (unsigned char row = 0; row < PIX_BUFFER_HEIGHT; row++) {
+    if (row < PIX_BUFFER_HEIGHT / 2) {
+      level = ((PIX_BUFFER_HEIGHT / 2 - 1 - row) * CEILING_MAX_LEVEL) / (PIX_BUFFER_HEIGHT / 2);
+    } else {
+      level = ((row - PIX_BUFFER_HEIGHT / 2) * FLOOR_MAX_LEVEL) / (PIX_BUFFER_HEIGHT / 2);
+    }
+    // Старший бит — левый пиксель; порог повторяется каждые 4 пикселя
+    pattern = 0;
+    for (unsigned char bit = 0; bit < 8; bit++) {
+      if (bayer[row & 3][bit & 3] < level) pattern |= 0x80 >> bit;
+    }
+    gap_patterns[row] = pattern;
+  }
+}
+#endif
+
+// === ТАБЛИЦА АРКТАНГЕНСА ДЛЯ ПРОЕКЦИИ ОБЪЕКТОВ ===
+// Смещение объекта от центра — arctg(side / fwd) в единицах 1/256 круга,
+// в столбцы его переводит ANGLE_COLUMNS() (при VIEW_FOV == VIEW_WIDTH
+// столбец = угол, как в trace_ray()). Граница между смещениями a и
+// a + 1 — середина их тангенсов (тангенсы по таблице синусов).
+void calc_object_tables() {
+  unsigned char offset = 0, next = 1;
+  unsigned int bound;
+
+  for (unsigned char r = 0; r <= OBJECT_MAX_TAN; r++) {
+    for (;;) {
+      // 64 * (tg(a) + tg(a + 1)) / 2
+      bound = (32 * SIN(offset) + COS(offset) / 2) / COS(offset)
+            + (32 * SIN(next) + COS(next) / 2) / COS(next);
+      if (r < bound) break;
+      offset = next++;
+    }
+    object_tan_offsets[r] = offset;
+  }
+  objects_clear();
+}
+
+// === ТАБЛИЦА СПРАЙТОВ [МАТЕРИАЛ][ВЫСОТА] ===
+void calc_material_sprites() {
+  unsigned char lod;
+
+  for (unsigned char height = 0; height <= MAX_PROJECTION_HEIGHT; height++) {
+    // LOD 0 — полная 128-пиксельная текстура, LOD 4 — 8 пикселей
+    if (height <= 4) lod = 4;
+    else if (height <= 8) lod = 3;
+    else if (height <= 16) lod = 2;
+    else if (height <= 32) lod = 1;
+    else lod = 0;
+    for (unsigned char material = 0; material < NUM_WALL_MATERIALS; material++) {
+#if BANKED_ASSETS
+      material_sprites[material][height] = &banked_sprites[material * WALL_LODS + lod];
+#else
+      material_sprites[material][height] = all_sprites[material * WALL_LODS + lod];
+#endif
+    }
+  }
+}
+
+#if BANKED_ASSETS
+// === ПЕРЕНОС ПИКСЕЛЕЙ СПРАЙТОВ В БАНКИ ===
+// Ассет материала — его LOD подряд; описатели остаются в памяти и получают
+// адрес пикселей в слоте при подгрузке (fetch_materials()). Пока банк
+// подключён, память выше 0xC000 недоступна, поэтому ассет собирается в кэше
+// (ниже 0xC000): сжатые LOD распаковываются прямо туда, резидентных копий
+// пикселей нет. bank_alloc() не принимает ассет больше слота — кэша хватает.
+void calc_banked_sprites() {
+  unsigned int offset;
+  unsigned char material, lod, i, id;
+
+  bank_init();
+  for (material = 0; material < NUM_WALL_MATERIALS; material++) {
+    offset = 0;
+    for (lod = 0; lod < WALL_LODS; lod++) {
+      i = material * WALL_LODS + lod;
+      banked_sprites[i] = *all_sprites[i];
+      banked_offsets[i] = offset;
+      offset += banked_sprites[i].width * banked_sprites[i].height * 8;
+    }
+    id = bank_alloc(offset);
+    if (id == BANK_ASSET_NONE) continue;
+    for (lod = 0; lod < WALL_LODS; lod++) {
+      i = material * WALL_LODS + lod;
+#ifdef SPRITES_PACKED
+      lz_unpack(packed_sprites[i].p_packed, bank_cache + banked_offsets[i]);
+#else
+      memcpy(bank_cache + banked_offsets[i], all_sprites[i]->p_sprite,
+             banked_sprites[i].width * banked_sprites[i].height * 8);
+#endif
+    }
+    bank_write(id, 0, bank_cache, offset);
+  }
+}
+#endif
+
+#if PRESCALED_TEXTURES
+// === МАСШТАБИРОВАНИЕ ТЕКСТУР ПОД КАЖДУЮ ВЫСОТУ СТЕНЫ ===
+void calc_texture_cache() {
+  char *p_cache = texture_cache;
+
+  // Сверху вниз: нечётной высоте нужен уже готовый столбец высоты height + 1
+  for (unsigned char height = MAX_PROJECTION_HEIGHT; height > 0; height--) {
+    const t_sprite *p_sprite = material_sprites[0][height];
+    unsigned char src_rows = p_sprite->height * 8;
+    unsigned char rows = height * 2;
+    t_texture *p_texture = &textures[height];
+
+    p_texture->width = p_sprite->width;
+    if (height > 32 && (height & 1)) {
+      // Нечётная высота: середина столбца высоты height + 1
+      p_texture->p_data = textures[height + 1].p_data + 1;
+      p_texture->rows = rows + 2;
+      continue;
+    }
+    p_texture->p_data = p_cache;
+    p_texture->rows = rows;
+    for (unsigned char col = 0; col < p_sprite->width; col++) {
+      for (unsigned char row = 0; row < rows; row++) {
+        *p_cache++ = p_sprite->p_sprite[(row * src_rows / rows) * p_sprite->width + col];
+      }
+    }
+  }
+  // Высота 0 только стирает столбец
+  textures[0].p_data = texture_cache;
+  textures[0].width = 1;
+  textures[0].rows = 0;
+}
+#endif
+
+#if TRACE_MODE == TRACE_DDA
+// === ПРЕДВЫЧИСЛЕНИЕ ТАБЛИЦ ДЛЯ DDA ===
+void calc_dda_tables() {
+  // Обратные величины направления: длина луча на одну клетку по оси
+  ray_recip[0] = DDA_NO_CROSSING;  // Не используется: ось без пересечений (trace_ray_dda())
+  for (unsigned char i = 1; i < 128; i++) {
+    ray_recip[i] = (127U * 256U) / i;
+  }
+
+  // Поправка на угол столбца: перпендикуляр = дистанция * cos(смещения)
+  for (unsigned char col = 0; col < VIEW_WIDTH; col++) {
+    unsigned char angle = RAY_ANGLE(col);
+    int c = COS(angle);
+    ray_fisheye[col] = c >= 127 ? 255 : (unsigned char)((c * 256) / 127);
+  }
+
+  // Высота стены по перпендикулярной дистанции (середина интервала таблицы)
+  for (unsigned int i = 0; i < (DDA_MAX_DISTANCE >> DDA_HEIGHT_SHIFT); i++) {
+    unsigned int height = DDA_HEIGHT_SCALE / ((i << DDA_HEIGHT_SHIFT) + (1 << (DDA_HEIGHT_SHIFT - 1)));
+    dda_heights[i] = height > 255 ? 255 : height;
+  }
 }
+#endif
@@ -1,33 +1,378 @@
 #ifndef __ENGINE_H
 #define __ENGINE_H
 
-#include "sincos.h"
+// Только константы, типы и объявления: таблицы (sincos.h, scr_lines.h,
+// wall_sprites.h, map_data.h) подключает engine.c, поэтому engine.h можно
+// подключать в любой модуль без копии данных.
 #include "scr_addr.h"
-#include "wall_sprites.h"
-#include "map.h"
+#include "map_packed.h"   // Сгенерирован из map.h (tools/mapgen)
+
+// === ОКНО ОБЗОРА (выбирается при сборке: -DVIEW_WIDTH=24 -DVIEW_HEIGHT=96) ===
+// Окно VIEW_WIDTH столбцов (байт) на VIEW_HEIGHT строк стоит по центру
+// верхних двух третей экрана, горизонт — строка 64. VIEW_FOV — поле зрения
+// в единицах угла (1/256 круга); по умолчанию один угол на столбец, как
+// раньше. Высота стен масштабируется на VIEW_WIDTH / VIEW_FOV: узкое поле
+// увеличивает картинку, пропорции пикселя сохраняются. Рендер дешевеет
+// вместе с окном: лучей — VIEW_WIDTH, строк столбца — до VIEW_HEIGHT.
+#ifndef VIEW_WIDTH
+#define VIEW_WIDTH SCR_WIDTH
+#endif
+#ifndef VIEW_HEIGHT
+#define VIEW_HEIGHT 128
+#endif
+#ifndef VIEW_FOV
+#define VIEW_FOV VIEW_WIDTH
+#endif
+#if VIEW_WIDTH > SCR_WIDTH || (VIEW_WIDTH & 1) || VIEW_WIDTH < 8
+#error "VIEW_WIDTH: even number of columns, 8..32"
+#endif
+#if VIEW_HEIGHT > 128 || (VIEW_HEIGHT & 15) || VIEW_HEIGHT < 32
+#error "VIEW_HEIGHT: multiple of 16 rows (whole attribute rows around the horizon), 32..128"
+#endif
+#if VIEW_FOV < VIEW_WIDTH / 2 || VIEW_FOV > 48
+#error "VIEW_FOV: VIEW_WIDTH / 2 .. 48 angle units (wall height scale and object table)"
+#endif
+#define VIEW_LEFT ((SCR_WIDTH - VIEW_WIDTH) / 2)  // Первый столбец окна на экране
+#define VIEW_TOP ((128 - VIEW_HEIGHT) / 2)        // Первая строка окна на экране
+#define VIEW_AREA_SIZE 0x1000                     // Пиксели верхних двух третей экрана
+#define VIEW_ATTR_START ((VIEW_TOP / 8) * SCR_WIDTH + VIEW_LEFT)  // Первый атрибут окна
+// Адрес строки окна на экране (таблица экрана со сдвигом — константы времени сборки)
+#define VIEW_LINE(row) (screen_line_addrs[VIEW_TOP + (row)] + VIEW_LEFT)
+
+// Угол луча столбца от направления взгляда: по умолчанию сам номер столбца
+// от центра, иначе — таблица ray_angles[] (calc_view_tables())
+#if VIEW_FOV == VIEW_WIDTH
+#define RAY_ANGLE(col) ((col) - (VIEW_WIDTH / 2))
+#define ANGLE_COLUMNS(angle) (angle)
+#else
+#define RAY_ANGLE(col) ray_angles[col]
+#define ANGLE_COLUMNS(angle) (((angle) * VIEW_WIDTH + VIEW_FOV / 2) / VIEW_FOV)  // Угол -> столбцы
+#endif
 
 // === ПАРАМЕТРЫ РЕНДЕРА ===
-#define PIX_BUFFER_HEIGHT 128                     // Высота буфера пикселей (половина экрана вверх/вниз)
-#define PIX_BUFFER_SIZE (PIX_BUFFER_HEIGHT * SCR_WIDTH)  // Общий размер буфера (128 * 32 = 4096 байт)
+#define PIX_BUFFER_HEIGHT VIEW_HEIGHT             // Высота буфера пикселей (половина вверх/вниз от горизонта)
+#define PIX_BUFFER_SIZE (PIX_BUFFER_HEIGHT * VIEW_WIDTH) // Общий размер буфера (128 * 32 = 4096 байт)
 #define PIX_BUFFER_START (0xf000 - PIX_BUFFER_SIZE)      // Расположение буфера в верхней памяти (~0xE000)
 
 #define PIX_ATTR_BUFFER_HEIGHT (PIX_BUFFER_HEIGHT / 8)   // Атрибуты: 1 атрибут = 8 строк
-#define PIX_ATTR_BUFFER_SIZE (SCR_WIDTH * PIX_ATTR_BUFFER_HEIGHT)  // Размер буфера атрибутов
-#define PIX_ATTR_BUFFER_START ATTR_SCREEN_BUFFER_START
+#define PIX_ATTR_BUFFER_SIZE (VIEW_WIDTH * PIX_ATTR_BUFFER_HEIGHT)  // Размер буфера атрибутов
+#define PIX_ATTR_BUFFER_START (PIX_BUFFER_START - PIX_ATTR_BUFFER_SIZE)  // Сразу под pix_buffer (~0xDE00)
 
 #define MAX_DISTANCE 32                // Максимальная дистанция прорисовки (в шагах луча)
-#define INIT_WALL_HEIGHT (127 << 8)    // Начальная высота стены в фиксированной точке (8.8): 127 * 256
+#define WALL_HEIGHT_SCALE (127 * VIEW_WIDTH / VIEW_FOV)  // Высота стены в упор (127 при одном угле на столбец)
+#define INIT_WALL_HEIGHT ((unsigned int)WALL_HEIGHT_SCALE << 8) // Начальная высота стены (8.8)
 #define MAX_PROJECTION_HEIGHT (PIX_BUFFER_HEIGHT / 2)  // Макс. высота проекции на экран = 64 пикселя
 
-#define NUM_WALL_COLORS 6              // Количество текстур стен (на будущее; сейчас не используется)
+// === РЕЖИМ ТРАССИРОВКИ ЛУЧЕЙ (выбирается при сборке: -DTRACE_MODE=...) ===
+#define TRACE_STEP 0                   // Пошаговый марш с шагом (cos, sin) — эталон
+#define TRACE_DDA  1                   // Обход по границам клеток (DDA) без «рыбьего глаза»
+#define TRACE_SKIP 2                   // Марш как TRACE_STEP, но карта проверяется только при
+                                       // выходе из пустой окрестности (map_dist.h) — те же высоты
+#ifndef TRACE_MODE
+#define TRACE_MODE TRACE_STEP
+#endif
+
+#define DDA_MAX_DISTANCE (16 << 8)     // Дальность DDA (8.8, клетки); дальше стена невидима
+#define DDA_HEIGHT_SHIFT 4             // Шаг таблицы высот: 1/16 клетки
+#define DDA_HEIGHT_SCALE (WALL_HEIGHT_SCALE * 128U) // Высота = DDA_HEIGHT_SCALE / дистанция (8.8), как у марша
+#define DDA_NO_CROSSING 0xffff         // Луч параллелен оси: её границы не пересекаются
+
+// === КОПИРОВАНИЕ НА ЭКРАН ===
+#ifndef DIRTY_BLIT
+#define DIRTY_BLIT 1                   // Копировать на экран только изменённые столбцы
+#endif
+#define DIRTY_BLIT_MAX_COLUMNS (VIEW_WIDTH * 3 / 4)  // Больше изменённых столбцов — полное копирование
+#define DIRTY_CLEAN (PIX_BUFFER_HEIGHT / 2)         // Верхняя строка чистого столбца (пустой диапазон)
+
+// === ТЕНЕВОЙ ЭКРАН (ТОЛЬКО 128K) ===
+// Рендер сразу в неотображаемый экран и переключение экранов через порт 0x7FFD
+// в начале кадра: без копирования pix_buffer и без разрывов изображения.
+// Банк 7 постоянно подключён в 0xC000, поэтому данные и стек (0xF000–0xFFFF)
+// при инициализации переносятся в него; код обязан заканчиваться ниже 0xC000.
+#ifndef SHADOW_SCREEN
+#define SHADOW_SCREEN 0
+#endif
+#define SHADOW_SCREEN_START 0xc000     // Экран 1: банк 7, подключённый в 0xC000
+#define SHADOW_SCREEN_SIZE  0x1b00     // Пиксели + атрибуты
+#define UPPER_DATA_START (PIX_BUFFER_START + PIX_BUFFER_SIZE)  // Данные и стек выше pix_buffer
+#define BANK_PORT_SCREEN0 0x17         // ПЗУ 48K, банк 7 в 0xC000, показ экрана 0 (0x4000)
+#define BANK_PORT_SCREEN1 0x1f         // То же, показ экрана 1 (бит 3)
+
+#if SHADOW_SCREEN
+#undef DIRTY_BLIT
+#define DIRTY_BLIT 0                   // Копирования на экран больше нет
+#endif
+
+// === ПОВТОРНОЕ ИСПОЛЬЗОВАНИЕ СТОЛБЦОВ ПРИ ПОВОРОТЕ ===
+// Столбец n трассируется под углом n + player_angle, поэтому поворот на месте
+// сдвигает высоты и pix_buffer на разность углов; трассируются только новые
+// столбцы. DDA зависит от столбца (поправка «рыбьего глаза»), теневой экран
+// хранит кадр двухкадровой давности, а при VIEW_FOV != VIEW_WIDTH поворот
+// не кратен столбцу — там режим выключен.
+#ifndef ROTATE_REUSE
+#define ROTATE_REUSE 1
+#endif
+#if TRACE_MODE == TRACE_DDA || SHADOW_SCREEN || VIEW_FOV != VIEW_WIDTH
+#undef ROTATE_REUSE
+#define ROTATE_REUSE 0
+#endif
+#define HEIGHT_STALE 0x80              // Флаг высоты: столбец сдвинут с неверной фазой текстуры
+
+// === АДАПТИВНОЕ РАЗРЕШЕНИЕ ===
+// В движении трассируется каждый 2-й или 4-й столбец, промежуточные высоты
+// интерполируются. Шаг выбирает main() по времени предыдущего рендера, на
+// первом кадре без движения кадр перерисовывается с полным разрешением.
+#ifndef ADAPTIVE_RES
+#define ADAPTIVE_RES 0
+#endif
+#define ADAPTIVE_MAX_STEP 4            // Самый грубый шаг трассировки (столбцов)
+#define ADAPTIVE_TARGET_FRAMES 3       // Цель: рендер не дольше 3 кадров (~16 кадров/с)
+
+// === КОГЕРЕНТНАЯ ТРАССИРОВКА ===
+// Лучи бросаются через COHERENT_SPAN столбцов; если концы отрезка попали в
+// одну клетку на одном шаге марша и каждый луч между ними на этом шаге в той
+// же клетке, а шагом раньше в пустоте, середина получает ту же высоту без
+// марша, иначе отрезок делится пополам. Только для пошагового марша
+// (TRACE_STEP, TRACE_SKIP) и полного разрешения.
+#ifndef COHERENT_TRACE
+#define COHERENT_TRACE 0
+#endif
+#if TRACE_MODE == TRACE_DDA || ADAPTIVE_RES
+#undef COHERENT_TRACE
+#define COHERENT_TRACE 0
+#endif
+#define COHERENT_SPAN 8                // Начальный шаг (степень двойки)
+#define RAY_CELL_NONE 0xffff           // Луч не попал в стену
+
+// === АССЕМБЛЕРНЫЙ МАРШ ЛУЧА ===
+// TRACE_ASM=1: внутренний цикл trace_ray() — ядро на ассемблере Z80
+// (trace_march). x и y лежат в DE и DE' основного и альтернативного наборов,
+// шаги cos/sin — в BC и BC'. Высота луча зависит только от номера шага,
+// поэтому вместо неё считается число шагов до невидимости (trace_steps), а
+// высота берётся из hit_heights[] после попадания. Клетка карты ищется по
+// четырём таблицам, выровненным по странице: индекс — старший байт X или Y,
+// поиск — одно чтение (HL). Си-версия trace_ray() остаётся эталоном; на
+// хосте ядро заменяет Си-модель с теми же таблицами.
+#ifndef TRACE_ASM
+#define TRACE_ASM 0
+#endif
+#if TRACE_MODE != TRACE_STEP
+#undef TRACE_ASM
+#define TRACE_ASM 0
+#endif
+// Таблицы — сразу после карты, ниже таблицы IM 2 (0xBE00)
+#define TRACE_TABLES_START ((MAP_PACKED_START + MAP_PACKED_SIZE + 0xff) & 0xff00)
+#define TRACE_COLS_START   TRACE_TABLES_START              // Смещение клетки X в строке карты
+#define TRACE_MASKS_START  (TRACE_TABLES_START + 0x100)    // Маска клетки X в байте карты
+#define TRACE_ROWS_START   (TRACE_TABLES_START + 0x200)    // Младший байт адреса строки Y
+#define TRACE_ROWS_HI_START (TRACE_TABLES_START + 0x300)   // Старший байт адреса строки Y
+#define TRACE_TABLES_SIZE  0x400
+#if TRACE_ASM && TRACE_TABLES_START + TRACE_TABLES_SIZE > 0xbe00
+#error "TRACE_ASM: map too large for the trace tables below 0xBE00"
+#endif
+
+// === РАЗВЁРНУТЫЕ СТОЛБЦЫ СПРАЙТОВ ===
+// COMPILED_COLUMNS=1 рисует стены процедурами из wall_sprites.h (спрайты с
+// "compiled": true в manifest.json): ~5 КБ ПЗУ за отказ от цикла по строкам.
+// Процедуры пишут в линейный pix_buffer с шагом строки 32 байта, поэтому
+// с теневым экраном и узким окном не работают.
+#if SHADOW_SCREEN || VIEW_WIDTH != SCR_WIDTH
+#undef COMPILED_COLUMNS
+#define COMPILED_COLUMNS 0
+#endif
+
+// === ПРЕДМАСШТАБИРОВАННЫЕ ТЕКСТУРЫ ===
+// PRESCALED_TEXTURES=1: engine_init() масштабирует спрайт LOD первого
+// материала (кэш для всех трёх не помещается в память) на всю высоту
+// стены для каждой высоты 1..MAX_PROJECTION_HEIGHT и раскладывает столбцы
+// подряд (по столбцам), так что рисование — последовательное чтение без
+// выбора LOD. Выше 32 кэшируются только чётные высоты: нечётная берёт
+// соседнюю с обрезкой строки сверху и снизу. Кэш лежит в свободной памяти
+// 0xC000–0xD98F, занятой в режиме SHADOW_SCREEN экраном 1.
+#ifndef PRESCALED_TEXTURES
+#define PRESCALED_TEXTURES 0
+#endif
+#if SHADOW_SCREEN
+#undef PRESCALED_TEXTURES
+#define PRESCALED_TEXTURES 0
+#endif
+#if PRESCALED_TEXTURES
+#undef COMPILED_COLUMNS
+#define COMPILED_COLUMNS 0
+#endif
+#define TEXTURE_CACHE_START 0xc000
+#define TEXTURE_CACHE_SIZE 6544        // 2h * 1 (h <= 16) + 2h * 2 (h <= 32) + 2h * 3 (чётные h > 32)
+
+// === ТЕКСТУРЫ В БАНКАХ 128K ===
+// BANKED_ASSETS=1: пиксели спрайтов каждого материала (все LOD) лежат в
+// банках 1, 3, 4, 6 (bank.c), стены рисуются из BANK_SLOTS резидентных
+// слотов через копии описателей спрайтов. Изменённые столбцы рисуются
+// проходами: перед проходом недостающие материалы подгружаются в слоты,
+// поэтому банк переключается не чаще раза на материал за кадр, а цикл по
+// строкам столбца не меняется. Окно 0xC000 занято теневым экраном и кэшем
+// текстур — с ними режим выключен; развёрнутые столбцы хранят пиксели в
+// коде и выключаются сами. Карта остаётся резидентной: марш читает её на
+// каждом шаге.
+#ifndef BANKED_ASSETS
+#define BANKED_ASSETS 0
+#endif
+#if SHADOW_SCREEN || PRESCALED_TEXTURES
+#undef BANKED_ASSETS
+#define BANKED_ASSETS 0
+#endif
+#if BANKED_ASSETS
+#undef COMPILED_COLUMNS
+#define COMPILED_COLUMNS 0
+#endif
+#ifndef BANK_SLOTS
+#define BANK_SLOTS 2                   // Материалов в памяти одновременно
+#endif
+#define BANK_SLOT_SIZE 0x280           // Набор LOD материала (сейчас 624 байта)
+// Кэш — после карты и таблиц ядра марша, ниже таблицы IM 2 (0xBE00)
+#if TRACE_ASM
+#define BANK_CACHE_START (TRACE_TABLES_START + TRACE_TABLES_SIZE)
+#else
+#define BANK_CACHE_START TRACE_TABLES_START
+#endif
+#if BANKED_ASSETS && BANK_CACHE_START + BANK_SLOTS * BANK_SLOT_SIZE > 0xbe00
+#error "BANKED_ASSETS: bank cache does not fit below 0xBE00"
+#endif
+#if BANKED_ASSETS
+#include "bank.h"
+#endif
+
+// === АТРИБУТЫ (ЦВЕТ) ===
+#define ATTR_SKY    0b00001100         // Верхняя половина: бумага синяя, чернила зелёные
+#define ATTR_GROUND 0b00000100         // Нижняя половина: бумага чёрная, чернила зелёные
+#define ATTR_PAPER_MASK 0b00111000
+#define ATTR_BRIGHT 0b01000000
+
+// ATTR_SHADING=1: знакоместа со стеной окрашиваются по материалу и дистанции
+// (близкие — яркие, дальние — белёсые, как в дымке). Атрибуты столбца
+// пересчитываются только при его перерисовке и сравниваются с копией в
+// pix_attr_buffer: в экранные атрибуты пишутся лишь изменившиеся ячейки.
+#ifndef ATTR_SHADING
+#define ATTR_SHADING 0
+#endif
+#define SHADE_NEAR_HEIGHT 24           // Выше — яркий цвет материала
+#define SHADE_FAR_HEIGHT 8             // Не выше — цвет дымки
+#define SHADE_FOG_INK 7                // Белый
+
+// === ПОЛ И ПОТОЛОК ===
+// Строки над и под стеной заполняются не нулём, а байтом упорядоченного
+// дизеринга (Байер 4x4) для этой строки: плотность растёт к низу экрана
+// (ближний пол) и к верху (ближний потолок). Узор одинаков во всей строке,
+// поэтому заливка — та же запись байта на строку, что и очистка.
+#ifndef FLOOR_DITHER
+#define FLOOR_DITHER 0
+#endif
+#define FLOOR_MAX_LEVEL 8              // Из 16: плотность пола у нижнего края
+#define CEILING_MAX_LEVEL 4            // Плотность потолка у верхнего края
+
+// === МАТЕРИАЛЫ СТЕН ===
+// Значение клетки карты v > 0 — стена из материала v - 1. Спрайты материала
+// идут в all_sprites[] подряд от крупного LOD к мелкому (corn_mature_4..0,
+// corn_ripening_4..0, corn_baby_4..0).
+#define NUM_WALL_MATERIALS 3           // Зрелая, созревающая и молодая кукуруза
+#define WALL_LODS 5                    // Спрайтов LOD на материал
+
+// === ДОСТУП К КАРТЕ ===
+// Координаты клетки — байты (старшие байты координат 8.8). Аргументы
+// вычисляются дважды: передавайте только переменные.
+// Байт карты с клеткой (cx, cy): строка — сдвиг, клетка в строке — сдвиг X
+#define MAP_BYTE(cx, cy) map_packed[((unsigned int)(unsigned char)(cy) << MAP_ROW_SHIFT) \
+                                    | ((unsigned char)(cx) >> MAP_X_SHIFT)]
+// Ненулевое, если в клетке стена: одно AND с маской, без сдвига (горячий цикл луча)
+#define MAP_WALL_AT(cx, cy) (MAP_BYTE(cx, cy) & map_cell_masks[(cx) & MAP_X_MASK])
+// Значение клетки: 0 — проход, v > 0 — материал v - 1
+#define MAP_CELL_AT(cx, cy) ((MAP_BYTE(cx, cy) >> map_cell_shifts[(cx) & MAP_X_MASK]) & MAP_CELL_MASK)
+// Значение карты по координатам 8.8
+#define get_map_at(x, y) MAP_CELL_AT((x) >> 8, (y) >> 8)
+
+// === ОБЪЕКТЫ (BILLBOARD) ===
+// Объект — спрайт материала высотой в половину стены, стоящий на полу.
+// Проекция по тем же углам столбцов, что у trace_ray(); стены служат
+// буфером глубины (wall_height_buffer: выше — ближе).
+#define MAX_OBJECTS 8
+#define OBJECT_NONE 0xff               // Нет объекта / объект не виден
+#define OBJECT_MAX_TAN 48              // 64 * tg: до ~37°, чуть шире поля зрения
+
+typedef struct {
+  int x;                    // Позиция (8.8, клетки)
+  int y;
+  unsigned char material;   // Текстура (0..NUM_WALL_MATERIALS - 1)
+} t_object;
+
+// Столбцы текстуры для одной высоты стены (режим PRESCALED_TEXTURES)
+typedef struct {
+  const char *p_data;       // Первая строка столбца 0; столбец n — p_data + n * rows
+  unsigned char width;      // Число столбцов (ширина спрайта LOD)
+  unsigned char rows;       // Длина столбца в кэше
+} t_texture;
+
+// Результат трассировки луча в режиме DDA
+typedef struct {
+  unsigned char height;     // Высота стены в пикселях (0 — не видна)
+  unsigned char side;       // Пересечённая граница: 0 — вертикальная (x), 1 — горизонтальная (y)
+  unsigned char u;          // Текстурная координата вдоль грани (0–255)
+  unsigned char material;   // Материал стены (0..NUM_WALL_MATERIALS - 1)
+  unsigned int distance;    // Перпендикулярная дистанция (8.8, клетки)
+} t_ray_hit;
+
+// === ЭТАПЫ РЕНДЕРА (ДЛЯ ПРОФИЛИРОВАНИЯ) ===
+typedef enum {
+  STAGE_TRACE = 0,      // Пробрасывание лучей
+  STAGE_SMOOTH_LR,      // Сглаживание краёв (лево → право)
+  STAGE_SMOOTH_RL,      // Сглаживание краёв (право → лево)
+  STAGE_DRAW,           // Рисование текстур стен
+  STAGE_OBJECTS,        // Проекция, сортировка и рисование объектов
+  STAGE_COPY,           // Копирование буфера на экран
+  STAGE_COUNT
+} t_render_stage;
+
+// Отметка начала этапа; STAGE_COUNT завершает последний этап кадра.
+// По умолчанию пустая, профилировщик подставляет свою реализацию.
+// PROFILE_OVERLAY=1 — профилирование на самой машине (profile.c)
+#ifndef PROFILE_OVERLAY
+#define PROFILE_OVERLAY 0
+#endif
+#if PROFILE_OVERLAY && !defined(PROFILE_STAGE)
+#include "profile.h"
+#define PROFILE_STAGE(stage) profile_stage(stage)
+#endif
+#ifndef PROFILE_STAGE
+#define PROFILE_STAGE(stage)
+#endif
 
 void copy_pix_buf();                          // Копирует off-screen буфер на экран
-void draw_wall_sprite(unsigned char x, unsigned char height, unsigned char old_height); // Рисует текстуру стены в буфере
+void flip_screens();                          // Показывает нарисованный экран (режим SHADOW_SCREEN)
+void copy_dirty_pix_buf();                    // Копирует на экран только изменённые столбцы
+void copy_pix_run(unsigned char col, unsigned char width, unsigned char top); // Копирует полосу столбцов
+void draw_wall_sprite(unsigned char x, unsigned char height, unsigned char old_height, unsigned char material); // Рисует текстуру стены в буфере
+unsigned char shift_columns(signed char delta); // Сдвигает готовые столбцы при повороте
 void fill_wall_sprite(unsigned char x, unsigned char height); // (Не используется) Рисует шаблонную стену
-unsigned char trace_ray(int angle, int player_x, int player_y, int player_angle);           // Пробрасывает луч и возвращает высоту стены
-char get_map_at(unsigned int x, unsigned int y); // Получает значение карты по координатам
+unsigned char trace_ray(int angle, int player_x, int player_y, int player_angle);           // Пробрасывает луч и возвращает высоту стены (материал — в ray_material)
+unsigned char trace_ray_skip(int angle, int player_x, int player_y, int player_angle);      // То же с пропуском пустых клеток
+void trace_ray_dda(unsigned char col, int player_x, int player_y, int player_angle, t_ray_hit *p_hit); // Луч по границам клеток
 void pixel(unsigned char x, unsigned char y); // Устанавливает пиксель (не используется в основном цикле)
 void calc_distance_deltas();                  // Предвычисляет таблицу высот по дистанции
+void calc_view_tables();                      // Предвычисляет углы лучей столбцов (VIEW_FOV)
+void calc_dda_tables();                       // Предвычисляет таблицы для режима DDA
+void calc_trace_tables();                     // Предвычисляет таблицы карты для ядра марша (TRACE_ASM)
+void calc_texture_cache();                    // Масштабирует текстуры под каждую высоту стены
+void calc_material_sprites();                 // Строит таблицу спрайтов [материал][высота]
+void calc_banked_sprites();                   // Переносит пиксели спрайтов в банки (BANKED_ASSETS)
+void shade_column(unsigned char x, unsigned char height, unsigned char material); // Атрибуты столбца (ATTR_SHADING)
+void calc_gap_patterns();                     // Предвычисляет узоры пола и потолка (FLOOR_DITHER)
+void calc_object_tables();                    // Предвычисляет таблицу арктангенса для объектов
+void objects_clear();                         // Удаляет все объекты
+unsigned char object_add(int x, int y, unsigned char material); // Добавляет объект; номер или OBJECT_NONE
+void object_move(unsigned char id, int x, int y);                // Перемещает объект
+void draw_objects(int player_x, int player_y, int player_angle); // Рисует объекты поверх стен
+
+void trace_coherent(unsigned char *p_heights, unsigned char start, unsigned char end,
+                    int player_x, int player_y, int player_angle); // Трассировка с делением по краям стен
+void engine_set_ray_step(unsigned char step); // Шаг трассировки 1, 2 или 4 (ADAPTIVE_RES)
 
 void engine_init();
 void engine_render(int player_x, int player_y, int player_angle);
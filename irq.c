@@ -0,0 +1,64 @@
+#include <string.h>
+#include "irq.h"
+#include "sound.h"
+
+__at (IM2_TABLE_START) unsigned char im2_table[257];   // Таблица векторов IM 2
+__at (IM2_JUMP_START) unsigned char im2_jump[3];       // JP im2_handler
+
+// Порт ввода Sinclair Joystick (биты 0–4)
+__sfr __at 0xfe joystick_keys_port;
+
+volatile unsigned int frame_counter;
+
+// Кольцевая очередь: голову двигает только обработчик, хвост — только
+// основной цикл, поэтому запрещать прерывания при чтении не нужно
+static unsigned char input_queue[INPUT_QUEUE_SIZE];
+static volatile unsigned char input_head;
+static volatile unsigned char input_tail;
+
+// === ОБРАБОТЧИК КАДРОВОГО ПРЕРЫВАНИЯ ===
+void im2_handler() __interrupt {
+  // Нажатие = 0 на ZX, поэтому инвертируем
+  unsigned char keys = joystick_keys_port & 0x1f ^ 0x1f;
+  unsigned char next = (input_head + 1) & (INPUT_QUEUE_SIZE - 1);
+
+  frame_counter++;
+#if SOUND_MODE != SOUND_OFF
+  sound_frame();         // Ограниченная стоимость: рендер не ждёт звука
+#endif
+  // При переполнении кадр теряется: основной цикл отстал больше чем на 0,3 с
+  if (keys != INPUT_EMPTY && next != input_tail) {
+    input_queue[input_head] = keys;
+    input_head = next;
+  }
+}
+
+unsigned char input_pop() {
+  unsigned char keys;
+  if (input_tail == input_head) return INPUT_EMPTY;
+  keys = input_queue[input_tail];
+  input_tail = (input_tail + 1) & (INPUT_QUEUE_SIZE - 1);
+  return keys;
+}
+
+void irq_init() {
+  // Любой байт на шине данных даёт вектор IM2_VECTOR:IM2_VECTOR
+  memset(im2_table, IM2_VECTOR, sizeof(im2_table));
+  im2_jump[0] = 0xc3;  // JP nn
+  im2_jump[1] = (unsigned int)im2_handler & 0xff;
+  im2_jump[2] = (unsigned int)im2_handler >> 8;
+
+  __asm
+    di
+    ld a, #(IM2_TABLE_START >> 8)
+    ld i, a
+    im 2
+    ei
+  __endasm;
+}
+
+void irq_wait_frame() {
+  __asm
+    halt
+  __endasm;
+}
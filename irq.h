@@ -0,0 +1,23 @@
+#ifndef __IRQ_H
+#define __IRQ_H
+
+// === ПРЕРЫВАНИЯ IM 2 ===
+// Обработчик ПЗУ (IM 1) пользуется регистром IY, который SDCC занимает под
+// свои нужды, поэтому кадровое прерывание обслуживает собственный обработчик.
+#define IM2_TABLE_START 0xbe00         // Таблица векторов: 257 байт IM2_VECTOR
+#define IM2_VECTOR      0xbf           // Все векторы указывают на 0xBFBF
+#define IM2_JUMP_START  0xbfbf         // JP на обработчик (3 байта)
+
+// === ОЧЕРЕДЬ ВВОДА ===
+// Обработчик опрашивает джойстик каждый кадр и кладёт ненулевые состояния в
+// очередь; основной цикл разбирает её по одному такту обновления на элемент.
+#define INPUT_QUEUE_SIZE 16            // Степень двойки
+#define INPUT_EMPTY 0x00               // input_pop(): очередь пуста
+
+extern volatile unsigned int frame_counter;   // Число кадровых прерываний (50 Гц)
+
+void irq_init();                       // Включает IM 2 и разрешает прерывания
+void irq_wait_frame();                 // Ждёт следующего кадрового прерывания (HALT)
+unsigned char input_pop();             // Состояние клавиш за один кадр или INPUT_EMPTY
+
+#endif // __IRQ_H
@@ -6,12 +6,22 @@
 // Заголовочные файлы с константами и данными
 #include "scr_addr.h"      // Адреса экранной памяти ZX Spectrum
 #include "sincos.h"        // Таблицы синуса и косинуса (256 значений, фиксированная точка)
-#include "wall_sprites.h"  // Спрайты текстур стен
-#include "map.h"           // Карта уровня (32x32)
+#include "map_packed.h"    // Карта уровня (упакованная, из map.h)
 #include "engine.h"
+#include "irq.h"           // Кадровое прерывание (IM 2)
+#include "unpack.h"        // Распаковка сжатых данных
+#include "demo.h"          // Запись и воспроизведение ввода
+#include "sound.h"         // Музыка и эффекты из прерывания
 
 
 //#link "engine.c"
+//#link "irq.c"
+//#link "unpack.c"
+//#link "profile.c"
+//#link "bank.c"
+//#link "text.c"
+//#link "demo.c"
+//#link "sound.c"
 
 
 
@@ -30,57 +40,169 @@ __at (SCREEN_BUFFER_START) char screen_buf[0x1800];        // 6144 байт пи
 __at (ATTR_SCREEN_BUFFER_START) char attr_buf[0x300];      // 768 байт атрибутов
 
 // Внешние буферы для рендеринга (вне экранной области)
-__at (PIX_BUFFER_START) char pix_buffer[PIX_BUFFER_SIZE];              // Пиксельный буфер 128x32
+__at (PIX_BUFFER_START) char pix_buffer[PIX_BUFFER_SIZE];              // Пиксельный буфер VIEW_HEIGHT x VIEW_WIDTH
 __at (PIX_ATTR_BUFFER_START) char pix_attr_buffer[PIX_ATTR_BUFFER_SIZE]; // Атрибутный буфер
 
-// Порт ввода Sinclair Joystick (биты 0–4)
-__sfr __at 0xfe joystick_keys_port;
+// Сжатая заставка (wall_sprites.h, подключён в engine.c)
+extern const unsigned char splash_lz[];
+
+// === СКОРОСТЬ ИГРОКА (за один кадр 50 Гц) ===
+#define TURN_STEP 2                       // Поворот: 2/256 круга, полный оборот за 2,5 с
+#define MOVE_SHIFT 3                      // Шаг: (cos, sin) / 8 — около 3 клеток в секунду
+#define STEP_SOUND_FRAMES 12              // Звук шага раз в 12 кадров движения
+
+// === СТАРТОВАЯ ПОЗИЦИЯ (с неё же начинается каждый прогон демо) ===
+#define PLAYER_START_X (2 * 256)          // Фиксированная точка (8.8): 2.0
+#define PLAYER_START_Y (2 * 256)
+#define PLAYER_START_ANGLE 0
 
 // === ГЛОБАЛЬНОЕ СОСТОЯНИЕ ИГРОКА ===
-static unsigned int player_angle = 0;     // Угол взгляда (0–255 = полный круг)
-static int player_x = 2 * 256;            // Позиция игрока в фиксированной точке (8.8): 2.0
-static int player_y = 2 * 256;
-static unsigned char key;                 // Текущее нажатие клавиш
+static unsigned int player_angle = PLAYER_START_ANGLE; // Угол взгляда (0–255 = полный круг)
+static int player_x = PLAYER_START_X;     // Позиция игрока в фиксированной точке (8.8)
+static int player_y = PLAYER_START_Y;
 
-// === ГЛАВНАЯ ФУНКЦИЯ ===
-int main() {
+// === ОБНОВЛЕНИЕ ИГРОКА ЗА ОДИН КАДР (фиксированный шаг) ===
+// Клавиши проверяются по битам, поэтому поворот и движение сочетаются
+static void update_player(unsigned char key) {
   static int px, py; // Временные координаты для проверки коллизий
+  static unsigned char step_frames;  // Кадры движения с последнего звука шага
+  static unsigned char bumped;       // Игрок упирается в стену
+  int dx, dy;
+
+  if (key & KEY_LEFT)  player_angle -= TURN_STEP;   // Поворот влево
+  if (key & KEY_RIGHT) player_angle += TURN_STEP;   // Поворот вправо
+  // Нормализация угла в диапазон [0, 255]
+  player_angle = player_angle & 0x00ff;
+
+  if ((key & (KEY_UP | KEY_DOWN)) == 0) return;
+  dx = COS(player_angle) >> MOVE_SHIFT;
+  dy = SIN(player_angle) >> MOVE_SHIFT;
+  if (key & KEY_UP) {
+    // Движение вперёд: новая позиция = текущая + вектор направления
+    px = player_x + dx;
+    py = player_y + dy;
+  } else {
+    // Движение назад
+    px = player_x - dx;
+    py = player_y - dy;
+  }
+
+  // Проверка коллизии: если новая позиция — не стена, обновляем позицию
+  if (get_map_at(px, py) == 0) {
+    player_x = px;
+    player_y = py;
+    bumped = 0;
+    if (++step_frames == STEP_SOUND_FRAMES) {
+      step_frames = 0;
+      sound_play(SFX_STEP);
+    }
+  } else if (!bumped) {
+    // Удар звучит один раз, пока игрок не отойдёт от стены
+    bumped = 1;
+    sound_play(SFX_BUMP);
+  }
+}
 
+// === ГЛАВНАЯ ФУНКЦИЯ ===
+int main() {
+  static unsigned char key;   // Состояние клавиш за один кадр
+  unsigned char moved;
+#if DEMO_MODE == DEMO_RECORD
+  unsigned char fire_held = 0;  // FIRE не отпускался после последней выгрузки
+  unsigned char fire_frame = 0; // Младший байт frame_counter при последнем FIRE из очереди
+#endif
+#if ADAPTIVE_RES
+  unsigned char ray_step = 1;  // Шаг трассировки следующего кадра в движении
+  unsigned char coarse = 0;    // Показан кадр с пропущенными столбцами
+  unsigned int render_start, render_frames;
+#endif
+
+  // Заставка видна, пока engine_init() распаковывает и предвычисляет данные
+  lz_unpack(splash_lz, (unsigned char *)screen_buf);
   engine_init();
+  // Кусты кукурузы в коридорах у старта
+  object_add(5 * 256 + 128, 2 * 256 + 128, 1);
+  object_add(4 * 256 + 128, 1 * 256 + 128, 2);
+  object_add(9 * 256 + 128, 6 * 256 + 128, 0);
+  object_add(2 * 256 + 128, 8 * 256 + 128, 2);
+  irq_init();        // После engine_init: в режиме SHADOW_SCREEN он переносит стек
+#if SOUND_MODE != SOUND_OFF
+  sound_init();      // После irq_init: замер стоимости идёт по frame_counter
+#endif
+#if DEMO_MODE != DEMO_OFF
+  demo_start();
+#endif
   engine_render(player_x, player_y, player_angle);
-  
-  // Основной игровой цикл
+
+  // Основной цикл: кадр начинается сразу после прерывания, все накопленные
+  // за время рендера кадры ввода отрабатываются шагами фиксированной длины
   while(1) {
-    // Чтение состояния клавиш: инверсия, т.к. нажатие = 0 на ZX
-    key = joystick_keys_port & 0x1f ^ 0x1f;
-
-    // === УПРАВЛЕНИЕ ===
-    if (key == KEY_LEFT)  player_angle -= 8;   // Поворот влево
-    if (key == KEY_RIGHT) player_angle += 8;   // Поворот вправо
-    if (key == KEY_UP) {
-      // Движение вперёд: новая позиция = текущая + вектор направления
-      px = player_x + COS(player_angle);
-      py = player_y + SIN(player_angle);
+#if DEMO_MODE == DEMO_PLAYBACK
+    // Один записанный шаг на рендер без ожидания прерывания: кадры прогона
+    // не зависят от скорости машины
+    if ((key = demo_pop()) != INPUT_EMPTY) {
+      update_player(key);
+    } else {
+      // Конец демо: итог на экран и заново со стартовой позиции
+      demo_report();
+      player_x = PLAYER_START_X;
+      player_y = PLAYER_START_Y;
+      player_angle = PLAYER_START_ANGLE;
+      demo_start();
     }
-    if (key == KEY_DOWN) {
-      // Движение назад
-      px = player_x - COS(player_angle);
-      py = player_y - SIN(player_angle);
+    moved = 1;
+#else
+#if !SHADOW_SCREEN
+    irq_wait_frame();  // В режиме SHADOW_SCREEN ждёт сам flip_screens()
+#endif
+    moved = 0;
+    while ((key = input_pop()) != INPUT_EMPTY) {
+#if DEMO_MODE == DEMO_RECORD
+      // FIRE без направлений выгружает запись на ленту — один раз на нажатие:
+      // пока кнопка держится, прерывание кладёт FIRE в очередь каждый кадр
+      if (key == KEY_FIRE) {
+        if (!fire_held) demo_save();
+        fire_held = 1;
+        fire_frame = (unsigned char)frame_counter;  // После записи: во время неё прерывания запрещены
+        continue;
+      }
+      fire_held = 0;
+      demo_record(key);
+#endif
+      update_player(key);
+      moved = 1;
     }
-
-    // Проверка коллизии: если новая позиция — не стена, обновляем позицию
-    if (get_map_at(px, py) == 0) {
-      player_x = px;
-      player_y = py;
+#if DEMO_MODE == DEMO_RECORD
+    // Отпускание считается по кадрам прерывания, а не по проходам цикла: без
+    // irq_wait_frame() (SHADOW_SCREEN) цикл крутится между прерываниями. Очередь
+    // пуста, и прерывание fire_frame + 1 уже положило в неё кадр без FIRE.
+    // Младший байт читается одной командой и не рвётся прерыванием
+    if ((unsigned char)((unsigned char)frame_counter - fire_frame) >= 2) fire_held = 0;
+#endif
+#endif
+
+#if ADAPTIVE_RES
+    if (moved) {
+      // Шаг подбирается по времени предыдущего рендера: медленнее цели —
+      // грубее, вдвое быстрее — точнее
+      engine_set_ray_step(ray_step);
+      render_start = frame_counter;
+      engine_render(player_x, player_y, player_angle);
+      render_frames = frame_counter - render_start;
+      coarse = ray_step > 1;
+      if (render_frames > ADAPTIVE_TARGET_FRAMES && ray_step < ADAPTIVE_MAX_STEP) ray_step <<= 1;
+      else if (render_frames * 2 <= ADAPTIVE_TARGET_FRAMES && ray_step > 1) ray_step >>= 1;
+    } else if (coarse) {
+      // Камера остановилась: тот же кадр в полном разрешении
+      engine_set_ray_step(1);
+      engine_render(player_x, player_y, player_angle);
+      coarse = 0;
     }
-
-    // Нормализация угла в диапазон [0, 255]
-    player_angle = player_angle & 0x00ff;
-
-    if (key != 0x00) {
+#else
+    if (moved) {
       engine_render(player_x, player_y, player_angle);
     }
+#endif
   }
   return 0;
 }
-
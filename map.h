@@ -1,41 +1,43 @@
 #ifndef __MAP_H
 #define __MAP_H
 
-// map.h
+// map.h — исходник карты: движок читает упакованную карту (map_packed.h и
+// map_data.h), которую prepare.sh генерирует отсюда (tools/mapgen/mapgen.py)
+// 0 — проход, 1..NUM_WALL_MATERIALS — стена из материала (значение - 1)
 #define MAP_WIDTH 32
 #define MAP_HEIGHT 32
 
 const static char map[MAP_HEIGHT][MAP_WIDTH] = {
   {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
   {1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1},
-  {1,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,1},
-  {1,1,1,1,0,0,1,1,1,0,0,1,0,0,1,1,1,0,0,1,0,0,1,1,1,0,0,1,1,1,1,1},
-  {1,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,1},
-  {1,0,0,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,0,1},
+  {1,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,2,0,0,2,0,0,0,0,2,0,0,2,0,0,0,1},
+  {1,1,1,1,0,0,1,1,1,0,0,1,0,0,1,1,2,0,0,2,0,0,2,2,2,0,0,2,2,2,2,1},
+  {1,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,2,0,0,2,0,0,0,0,0,0,0,0,1},
+  {1,0,0,1,1,1,1,0,0,1,1,1,1,1,1,0,0,2,2,2,2,2,2,0,0,2,2,2,2,2,0,1},
   {1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1},
-  {1,1,0,1,0,0,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1},
-  {1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1},
-  {1,0,0,1,1,1,1,0,0,1,1,1,1,0,0,1,1,1,1,0,0,1,1,1,1,0,0,1,0,0,0,1},
-  {1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,1},
-  {1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,0,0,1,1,1,1,0,0,1,1,1,1,1,1,1,1},
-  {1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,1},
-  {1,0,0,1,1,1,1,0,0,1,1,1,1,1,1,1,0,0,1,0,0,1,1,1,1,0,0,1,1,1,0,1},
-  {1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,0,0,0,1},
-  {1,1,1,1,0,0,1,1,1,1,0,0,1,1,1,1,1,1,1,0,0,1,0,0,1,1,1,1,0,0,1,1},
-  {1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1},
-  {1,0,0,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0,0,1,0,0,1,1,1,1,1},
-  {1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1},
-  {1,1,1,1,0,0,1,1,1,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0,0,1,0,0,0,1},
-  {1,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,1},
-  {1,0,0,1,1,1,1,0,0,1,1,1,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0,0,1,1},
-  {1,0,0,1,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1},
-  {1,1,1,1,0,0,1,1,1,1,0,0,1,1,1,0,0,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1},
-  {1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,1},
-  {1,0,0,1,1,1,1,0,0,1,1,1,1,0,0,1,1,1,0,0,1,0,0,1,0,0,1,1,1,1,0,1},
-  {1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,1,0,0,0,0,1},
-  {1,1,1,1,0,0,1,1,1,1,0,0,1,1,1,1,0,0,1,1,1,0,0,1,1,1,1,0,0,1,1,1},
-  {1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,1},
-  {1,0,0,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,0,1},
+  {1,1,0,1,0,0,1,1,1,0,0,1,1,1,1,1,2,0,0,2,2,2,2,2,2,0,0,2,2,2,2,1},
+  {1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,1},
+  {1,0,0,1,1,1,1,0,0,1,1,1,1,0,0,1,2,2,2,0,0,2,2,2,2,0,0,2,0,0,0,1},
+  {1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,2,0,0,0,0,0,2,0,0,0,1},
+  {1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,0,0,2,2,2,2,0,0,2,2,2,2,2,2,2,1},
+  {1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,2,0,0,0,0,0,2,0,0,0,0,0,0,1},
+  {1,0,0,1,1,1,1,0,0,1,1,1,1,1,1,1,0,0,2,0,0,2,2,2,2,0,0,2,2,2,0,1},
+  {1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,2,0,0,2,0,0,0,0,0,2,0,0,0,1},
+  {1,1,1,1,0,0,1,1,1,1,0,0,1,1,1,1,2,2,2,0,0,2,0,0,2,2,2,2,0,0,2,1},
+  {1,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,1},
+  {1,0,0,3,3,3,3,3,3,3,3,3,3,0,0,3,1,1,1,1,1,1,0,0,1,0,0,1,1,1,1,1},
+  {1,0,0,3,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1},
+  {1,3,3,3,0,0,3,3,3,0,0,3,3,3,3,3,0,0,1,1,1,1,1,1,1,0,0,1,0,0,0,1},
+  {1,0,0,0,0,0,3,0,0,0,0,3,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,1},
+  {1,0,0,3,3,3,3,0,0,3,3,3,0,0,3,3,1,1,1,0,0,1,1,1,1,1,1,1,0,0,1,1},
+  {1,0,0,3,0,0,0,0,0,3,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1},
+  {1,3,3,3,0,0,3,3,3,3,0,0,3,3,3,0,0,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1},
+  {1,0,0,0,0,0,3,0,0,0,0,0,3,0,0,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,1},
+  {1,0,0,3,3,3,3,0,0,3,3,3,3,0,0,3,1,1,0,0,1,0,0,1,0,0,1,1,1,1,0,1},
+  {1,0,0,3,0,0,0,0,0,3,0,0,0,0,0,3,0,0,0,0,1,0,0,1,0,0,1,0,0,0,0,1},
+  {1,3,3,3,0,0,3,3,3,3,0,0,3,3,3,3,0,0,1,1,1,0,0,1,1,1,1,0,0,1,1,1},
+  {1,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,1},
+  {1,0,0,3,3,3,3,3,3,3,3,3,3,0,0,3,1,1,1,0,0,1,1,1,1,1,1,1,1,1,0,1},
   {1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1},
   {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1}
 };
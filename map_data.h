@@ -0,0 +1,44 @@
+#ifndef __MAP_DATA_H
+#define __MAP_DATA_H
+
+// Сгенерировано tools/mapgen/mapgen.py из map.h — не редактировать.
+// Данные карты для map_packed.h; подключается в одну единицу трансляции.
+const unsigned char map_cell_masks[4] = {0x03,0x0c,0x30,0xc0};
+const unsigned char map_cell_shifts[4] = {0,2,4,6};
+
+const unsigned char __at (MAP_PACKED_START) map_packed[MAP_PACKED_SIZE] = {
+  0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+  0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x40,
+  0x01,0x00,0x41,0x00,0x82,0x00,0x82,0x40,
+  0x55,0x50,0x41,0x50,0x82,0xa0,0x82,0x6a,
+  0x01,0x10,0x40,0x10,0x80,0x20,0x00,0x40,
+  0x41,0x15,0x54,0x15,0xa8,0x2a,0xa8,0x4a,
+  0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x40,
+  0x45,0x50,0x41,0x55,0x82,0xaa,0x82,0x6a,
+  0x01,0x10,0x00,0x00,0x00,0x00,0x80,0x40,
+  0x41,0x15,0x54,0x41,0x2a,0xa8,0x82,0x40,
+  0x01,0x00,0x00,0x41,0x00,0x08,0x80,0x40,
+  0x55,0x55,0x55,0x41,0xa0,0x0a,0xaa,0x6a,
+  0x01,0x00,0x00,0x40,0x20,0x00,0x02,0x40,
+  0x41,0x15,0x54,0x55,0x20,0xa8,0x82,0x4a,
+  0x41,0x10,0x04,0x00,0x20,0x08,0x80,0x40,
+  0x55,0x50,0x05,0x55,0x2a,0x08,0xaa,0x60,
+  0x01,0x00,0x00,0x03,0x00,0x04,0x01,0x50,
+  0xc1,0xff,0xff,0xc3,0x55,0x05,0x41,0x55,
+  0xc1,0x00,0x00,0xc0,0x00,0x00,0x41,0x40,
+  0xfd,0xf0,0xc3,0xff,0x50,0x55,0x41,0x40,
+  0x01,0x30,0xc0,0x00,0x10,0x00,0x40,0x40,
+  0xc1,0x3f,0xfc,0xf0,0x15,0x54,0x55,0x50,
+  0xc1,0x00,0x0c,0x30,0x00,0x00,0x00,0x50,
+  0xfd,0xf0,0x0f,0x3f,0x54,0x41,0x55,0x55,
+  0x01,0x30,0x00,0x03,0x04,0x41,0x00,0x40,
+  0xc1,0x3f,0xfc,0xc3,0x05,0x41,0x50,0x45,
+  0xc1,0x00,0x0c,0xc0,0x00,0x41,0x10,0x40,
+  0xfd,0xf0,0x0f,0xff,0x50,0x41,0x15,0x54,
+  0x01,0x00,0x00,0x03,0x10,0x00,0x00,0x44,
+  0xc1,0xff,0xff,0xc3,0x15,0x54,0x55,0x45,
+  0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x40,
+  0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55
+};
+
+#endif // __MAP_DATA_H
@@ -0,0 +1,29 @@
+#ifndef __MAP_PACKED_H
+#define __MAP_PACKED_H
+
+// Сгенерировано tools/mapgen/mapgen.py из map.h — не редактировать.
+// Бит на клетку: 2, клеток в байте: 4, клетка 0 — в младших битах.
+// Строка дополнена до 32 клеток (8 байт), вся карта — 256 байт.
+#define MAP_WIDTH 32
+#define MAP_HEIGHT 32
+#define MAP_CELL_BITS 2
+#define MAP_CELL_MASK 0x03
+#define MAP_ROW_SHIFT 3           // log2(байт в строке)
+#define MAP_X_SHIFT 2             // log2(клеток в байте)
+#define MAP_X_MASK 3              // Номер клетки внутри байта
+#define MAP_PACKED_SIZE 256
+
+// Карта лежит между кодом и таблицей IM 2 (0xBE00): до 7,5 КБ
+#ifndef MAP_PACKED_START
+#define MAP_PACKED_START 0xa000
+#endif
+
+// Маска и сдвиг клетки внутри байта по младшим битам X
+extern const unsigned char map_cell_masks[1 << MAP_X_SHIFT];
+extern const unsigned char map_cell_shifts[1 << MAP_X_SHIFT];
+
+// Начало карты выровнено по странице: старший байт адреса — база плюс
+// старшие биты Y, младший — остальные биты Y и X, без переносов
+extern const unsigned char map_packed[MAP_PACKED_SIZE];
+
+#endif // __MAP_PACKED_H
@@ -1,3 +1,5 @@
 #!/bin/sh
 
 tools/extractor/extractor.py manifest.json wall_sprites.h
+tools/mapgen/mapgen.py map.h map_dist.h map_packed.h map_data.h
+tools/demo/demo2h.py tools/demo/attract.txt demo_data.h
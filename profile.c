@@ -0,0 +1,88 @@
+#include <string.h>
+#include "engine.h"
+#include "irq.h"
+#include "profile.h"
+#include "text.h"
+
+#if PROFILE_OVERLAY
+
+// Порт 0xFE: биты 0–2 — цвет бордюра
+__sfr __at (0xfe) border_port;
+
+// Цвет бордюра и подписи этапа; STAGE_COUNT — время вне рендера (чёрный)
+static const unsigned char stage_colors[STAGE_COUNT + 1] = {
+  1,  // Трассировка: синий
+  2,  // Сглаживание лево → право: красный
+  3,  // Сглаживание право → лево: пурпурный
+  4,  // Стены: зелёный
+  5,  // Объекты: голубой
+  6,  // Копирование: жёлтый
+  0
+};
+static const char * const stage_labels[STAGE_COUNT] = {
+  "TRACE", "SM LR", "SM RL", "WALLS", "OBJS ", "COPY "
+};
+
+unsigned char profile_border;
+static unsigned char current_stage = STAGE_COUNT;
+static unsigned int stage_start;
+static unsigned char stage_ticks[STAGE_COUNT];   // Кадры прерывания за текущий рендер
+static unsigned int stage_avg[STAGE_COUNT];      // Скользящее среднее (8.8, кадры)
+
+// Десятые доли миллисекунды: "9999.9"
+static void put_tenths(unsigned char row, unsigned char col, unsigned int value) {
+  char text[7];
+  unsigned char i = 6;
+
+  text[6] = 0;
+  do {
+    text[--i] = '0' + value % 10;
+    value /= 10;
+    if (i == 5) text[--i] = '.';
+  } while (value || i > 3);
+  while (i) text[--i] = ' ';
+  text_put_string(row, col, text);
+}
+
+void profile_init() {
+  text_set_row_attr(PROFILE_TEXT_ROW, ATTR_BRIGHT | 7);
+  text_put_string(PROFILE_TEXT_ROW, 0, "STAGE      MS");
+  for (unsigned char s = 0; s < STAGE_COUNT; s++) {
+    text_set_row_attr(PROFILE_TEXT_ROW + 1 + s, ATTR_BRIGHT | stage_colors[s]);
+    text_put_string(PROFILE_TEXT_ROW + 1 + s, 0, stage_labels[s]);
+  }
+  text_set_row_attr(PROFILE_TEXT_ROW + 1 + STAGE_COUNT, ATTR_BRIGHT | 7);
+  text_put_string(PROFILE_TEXT_ROW + 1 + STAGE_COUNT, 0, "TOTAL");
+}
+
+// Звук идёт из прерывания и в этапы не попадает: его стоимость замеряется
+// один раз (sound_init()) и печатается в миллисекундах на кадр 50 Гц
+void profile_audio(unsigned char calls) {
+  text_put_string(PROFILE_TEXT_ROW + 1 + STAGE_COUNT, PROFILE_AUDIO_COL, "AUDIO");
+  put_tenths(PROFILE_TEXT_ROW + 1 + STAGE_COUNT, PROFILE_AUDIO_COL + 6, calls ? 200 / calls : 9999);
+}
+
+// === ОТМЕТКА ЭТАПА ===
+void profile_stage(unsigned char stage) {
+  unsigned int now = frame_counter;
+  unsigned long total = 0;
+
+  profile_border = stage_colors[stage];
+  border_port = profile_border;
+  if (current_stage < STAGE_COUNT) stage_ticks[current_stage] += now - stage_start;
+  current_stage = stage;
+  stage_start = now;
+  if (stage != STAGE_COUNT) return;
+
+  // Конец кадра: среднее += (новое - среднее) / 8, печать в миллисекундах
+  // (кадр прерывания — 20 мс, в десятых долях — 200)
+  for (unsigned char s = 0; s < STAGE_COUNT; s++) {
+    stage_avg[s] += ((unsigned int)stage_ticks[s] << (8 - PROFILE_AVG_SHIFT)) - (stage_avg[s] >> PROFILE_AVG_SHIFT);
+    stage_ticks[s] = 0;
+    total += stage_avg[s];
+    put_tenths(PROFILE_TEXT_ROW + 1 + s, 7, ((unsigned long)stage_avg[s] * 200) >> 8);
+  }
+  total = (total * 200) >> 8;
+  put_tenths(PROFILE_TEXT_ROW + 1 + STAGE_COUNT, 7, total > 0xffff ? 0xffff : total);
+}
+#endif
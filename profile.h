@@ -0,0 +1,21 @@
+#ifndef __PROFILE_H
+#define __PROFILE_H
+
+// === ПРОФИЛИРОВАНИЕ НА ЦЕЛЕВОЙ МАШИНЕ (PROFILE_OVERLAY) ===
+// Каждый этап engine_render() красит бордюр своим цветом, поэтому на
+// экране (или в эмуляторе) видны полосы пропорционально времени этапов.
+// Время этапов в кадрах прерывания (frame_counter; системная переменная
+// FRAMES при IM 2 не обновляется) усредняется и печатается в нижней трети
+// экрана, которую рендер не трогает.
+#define PROFILE_TEXT_ROW 16            // Первая текстовая строка таблицы (TEXT_FIRST_ROW)
+#define PROFILE_AVG_SHIFT 3            // Скользящее среднее: вес нового кадра 1/8
+#define PROFILE_AUDIO_COL 20           // Стоимость звука — справа в строке TOTAL
+#define PROFILE_AUDIO_COLOR 7          // Бордюр во время sound_frame(): белый
+
+extern unsigned char profile_border;   // Цвет текущего этапа (его восстанавливает звук)
+
+void profile_init();                   // Атрибуты и подписи нижней трети
+void profile_stage(unsigned char stage); // Отметка начала этапа (STAGE_COUNT — конец кадра)
+void profile_audio(unsigned char calls); // Печать стоимости кадра звука (вызовов за кадр)
+
+#endif // __PROFILE_H
@@ -0,0 +1,34 @@
+#ifndef __SCR_LINES_H
+#define __SCR_LINES_H
+
+#include "scr_addr.h"
+
+// Адрес начала каждой из 192 строк экрана (данные: подключает только engine.c)
+static char * const screen_line_addrs[SCR_HEIGHT] = {
+    SCR_ADDR(0x4000), SCR_ADDR(0x4100), SCR_ADDR(0x4200), SCR_ADDR(0x4300), SCR_ADDR(0x4400), SCR_ADDR(0x4500), SCR_ADDR(0x4600), SCR_ADDR(0x4700),
+    SCR_ADDR(0x4020), SCR_ADDR(0x4120), SCR_ADDR(0x4220), SCR_ADDR(0x4320), SCR_ADDR(0x4420), SCR_ADDR(0x4520), SCR_ADDR(0x4620), SCR_ADDR(0x4720),
+    SCR_ADDR(0x4040), SCR_ADDR(0x4140), SCR_ADDR(0x4240), SCR_ADDR(0x4340), SCR_ADDR(0x4440), SCR_ADDR(0x4540), SCR_ADDR(0x4640), SCR_ADDR(0x4740),
+    SCR_ADDR(0x4060), SCR_ADDR(0x4160), SCR_ADDR(0x4260), SCR_ADDR(0x4360), SCR_ADDR(0x4460), SCR_ADDR(0x4560), SCR_ADDR(0x4660), SCR_ADDR(0x4760),
+    SCR_ADDR(0x4080), SCR_ADDR(0x4180), SCR_ADDR(0x4280), SCR_ADDR(0x4380), SCR_ADDR(0x4480), SCR_ADDR(0x4580), SCR_ADDR(0x4680), SCR_ADDR(0x4780),
+    SCR_ADDR(0x40a0), SCR_ADDR(0x41a0), SCR_ADDR(0x42a0), SCR_ADDR(0x43a0), SCR_ADDR(0x44a0), SCR_ADDR(0x45a0), SCR_ADDR(0x46a0), SCR_ADDR(0x47a0),
+    SCR_ADDR(0x40c0), SCR_ADDR(0x41c0), SCR_ADDR(0x42c0), SCR_ADDR(0x43c0), SCR_ADDR(0x44c0), SCR_ADDR(0x45c0), SCR_ADDR(0x46c0), SCR_ADDR(0x47c0),
+    SCR_ADDR(0x40e0), SCR_ADDR(0x41e0), SCR_ADDR(0x42e0), SCR_ADDR(0x43e0), SCR_ADDR(0x44e0), SCR_ADDR(0x45e0), SCR_ADDR(0x46e0), SCR_ADDR(0x47e0),
+    SCR_ADDR(0x4800), SCR_ADDR(0x4900), SCR_ADDR(0x4a00), SCR_ADDR(0x4b00), SCR_ADDR(0x4c00), SCR_ADDR(0x4d00), SCR_ADDR(0x4e00), SCR_ADDR(0x4f00),
+    SCR_ADDR(0x4820), SCR_ADDR(0x4920), SCR_ADDR(0x4a20), SCR_ADDR(0x4b20), SCR_ADDR(0x4c20), SCR_ADDR(0x4d20), SCR_ADDR(0x4e20), SCR_ADDR(0x4f20),
+    SCR_ADDR(0x4840), SCR_ADDR(0x4940), SCR_ADDR(0x4a40), SCR_ADDR(0x4b40), SCR_ADDR(0x4c40), SCR_ADDR(0x4d40), SCR_ADDR(0x4e40), SCR_ADDR(0x4f40),
+    SCR_ADDR(0x4860), SCR_ADDR(0x4960), SCR_ADDR(0x4a60), SCR_ADDR(0x4b60), SCR_ADDR(0x4c60), SCR_ADDR(0x4d60), SCR_ADDR(0x4e60), SCR_ADDR(0x4f60),
+    SCR_ADDR(0x4880), SCR_ADDR(0x4980), SCR_ADDR(0x4a80), SCR_ADDR(0x4b80), SCR_ADDR(0x4c80), SCR_ADDR(0x4d80), SCR_ADDR(0x4e80), SCR_ADDR(0x4f80),
+    SCR_ADDR(0x48a0), SCR_ADDR(0x49a0), SCR_ADDR(0x4aa0), SCR_ADDR(0x4ba0), SCR_ADDR(0x4ca0), SCR_ADDR(0x4da0), SCR_ADDR(0x4ea0), SCR_ADDR(0x4fa0),
+    SCR_ADDR(0x48c0), SCR_ADDR(0x49c0), SCR_ADDR(0x4ac0), SCR_ADDR(0x4bc0), SCR_ADDR(0x4cc0), SCR_ADDR(0x4dc0), SCR_ADDR(0x4ec0), SCR_ADDR(0x4fc0),
+    SCR_ADDR(0x48e0), SCR_ADDR(0x49e0), SCR_ADDR(0x4ae0), SCR_ADDR(0x4be0), SCR_ADDR(0x4ce0), SCR_ADDR(0x4de0), SCR_ADDR(0x4ee0), SCR_ADDR(0x4fe0),
+    SCR_ADDR(0x5000), SCR_ADDR(0x5100), SCR_ADDR(0x5200), SCR_ADDR(0x5300), SCR_ADDR(0x5400), SCR_ADDR(0x5500), SCR_ADDR(0x5600), SCR_ADDR(0x5700),
+    SCR_ADDR(0x5020), SCR_ADDR(0x5120), SCR_ADDR(0x5220), SCR_ADDR(0x5320), SCR_ADDR(0x5420), SCR_ADDR(0x5520), SCR_ADDR(0x5620), SCR_ADDR(0x5720),
+    SCR_ADDR(0x5040), SCR_ADDR(0x5140), SCR_ADDR(0x5240), SCR_ADDR(0x5340), SCR_ADDR(0x5440), SCR_ADDR(0x5540), SCR_ADDR(0x5640), SCR_ADDR(0x5740),
+    SCR_ADDR(0x5060), SCR_ADDR(0x5160), SCR_ADDR(0x5260), SCR_ADDR(0x5360), SCR_ADDR(0x5460), SCR_ADDR(0x5560), SCR_ADDR(0x5660), SCR_ADDR(0x5760),
+    SCR_ADDR(0x5080), SCR_ADDR(0x5180), SCR_ADDR(0x5280), SCR_ADDR(0x5380), SCR_ADDR(0x5480), SCR_ADDR(0x5580), SCR_ADDR(0x5680), SCR_ADDR(0x5780),
+    SCR_ADDR(0x50a0), SCR_ADDR(0x51a0), SCR_ADDR(0x52a0), SCR_ADDR(0x53a0), SCR_ADDR(0x54a0), SCR_ADDR(0x55a0), SCR_ADDR(0x56a0), SCR_ADDR(0x57a0),
+    SCR_ADDR(0x50c0), SCR_ADDR(0x51c0), SCR_ADDR(0x52c0), SCR_ADDR(0x53c0), SCR_ADDR(0x54c0), SCR_ADDR(0x55c0), SCR_ADDR(0x56c0), SCR_ADDR(0x57c0),
+    SCR_ADDR(0x50e0), SCR_ADDR(0x51e0), SCR_ADDR(0x52e0), SCR_ADDR(0x53e0), SCR_ADDR(0x54e0), SCR_ADDR(0x55e0), SCR_ADDR(0x56e0), SCR_ADDR(0x57e0)
+};
+
+#endif // __SCR_LINES_H
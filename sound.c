@@ -0,0 +1,271 @@
+#include "engine.h"
+#include "irq.h"
+#include "sound.h"
+
+#if SOUND_MODE != SOUND_OFF
+
+// Порт 0xFE: бордюр (биты 0–2) и динамик (бит 4)
+__sfr __at (0xfe) ula_port;
+
+// Бордюр во время щелчков: под профилировщиком — полоса звука
+#if PROFILE_OVERLAY
+#define SOUND_BORDER PROFILE_AUDIO_COLOR
+#else
+#define SOUND_BORDER 0
+#endif
+
+static unsigned char playing;                    // 0 — обработчик прерывания звук не трогает
+static volatile unsigned char sfx_request;       // Эффект + 1 от sound_play(), 0 — нет
+
+#if SOUND_MODE == SOUND_AY
+// === МУЗЫКА ===
+// Ноты C2–B5: период тона AY_CLOCK / (16 * f)
+static const unsigned int note_periods[48] = {
+  1695, 1599, 1510, 1425, 1345, 1270, 1198, 1131, 1068, 1008, 951, 898,
+  847, 800, 755, 712, 673, 635, 599, 566, 534, 504, 476, 449,
+  424, 400, 377, 356, 336, 317, 300, 283, 267, 252, 238, 224,
+  212, 200, 189, 178, 168, 159, 150, 141, 133, 126, 119, 112
+};
+
+// Мелодия: пары (нота, длительность в кадрах); нота — полутон от C2 плюс 1,
+// REST — пауза, SONG_LOOP возвращает канал к началу
+#define NOTE_C 1
+#define NOTE_D 3
+#define NOTE_E 5
+#define NOTE_F 6
+#define NOTE_G 8
+#define NOTE_A 10
+#define NOTE_B 12
+#define NOTE(name, octave) (NOTE_##name + ((octave) - 2) * 12)
+#define REST 0
+#define SONG_LOOP 0xff
+#define EIGHTH 12                                // Восьмая: 12 кадров, 125 ударов в минуту
+
+static const unsigned char melody[] = {
+  NOTE(A, 4), EIGHTH, NOTE(C, 5), EIGHTH, NOTE(E, 5), EIGHTH, NOTE(C, 5), EIGHTH,
+  NOTE(D, 5), EIGHTH, NOTE(C, 5), EIGHTH, NOTE(B, 4), EIGHTH, NOTE(G, 4), EIGHTH,
+  NOTE(A, 4), EIGHTH, NOTE(C, 5), EIGHTH, NOTE(E, 5), EIGHTH, NOTE(A, 5), EIGHTH,
+  NOTE(G, 5), 2 * EIGHTH, NOTE(E, 5), 2 * EIGHTH,
+  NOTE(F, 5), EIGHTH, NOTE(E, 5), EIGHTH, NOTE(D, 5), EIGHTH, NOTE(C, 5), EIGHTH,
+  NOTE(B, 4), EIGHTH, NOTE(C, 5), EIGHTH, NOTE(D, 5), EIGHTH, NOTE(B, 4), EIGHTH,
+  NOTE(A, 4), 3 * EIGHTH, REST, EIGHTH, NOTE(E, 4), 2 * EIGHTH, REST, 2 * EIGHTH,
+  SONG_LOOP
+};
+
+static const unsigned char bass[] = {
+  NOTE(A, 2), 4 * EIGHTH, NOTE(G, 2), 4 * EIGHTH,
+  NOTE(F, 2), 4 * EIGHTH, NOTE(E, 2), 4 * EIGHTH,
+  NOTE(D, 2), 4 * EIGHTH, NOTE(G, 2), 4 * EIGHTH,
+  NOTE(A, 2), 4 * EIGHTH, NOTE(E, 2), 4 * EIGHTH,
+  SONG_LOOP
+};
+
+typedef struct {
+  const unsigned char *p_start;
+  const unsigned char *p_next;                   // Следующая нота
+  unsigned char left;                            // Кадров до следующей ноты
+  unsigned char volume;
+  unsigned char attack;                          // Громкость в начале ноты
+  unsigned char sustain;                         // Громкость после затухания (по 1 за кадр)
+} t_channel;
+
+static t_channel channels[2] = {
+  { melody, melody, 0, 0, 12, 7 },               // Канал A
+  { bass, bass, 0, 0, 13, 9 }                    // Канал B
+};
+
+// === ЭФФЕКТЫ (канал C) ===
+typedef struct {
+  unsigned int tone;                             // Период тона, 0 — без тона
+  unsigned char noise;                           // Период шума, 0 — без шума
+  unsigned char volume;                          // 0 — конец эффекта
+} t_sfx_frame;
+
+static const t_sfx_frame sfx_step[] = {
+  { 0, 12, 9 }, { 0, 16, 6 }, { 0, 20, 3 }, { 0, 0, 0 }
+};
+static const t_sfx_frame sfx_bump[] = {
+  { 2000, 24, 13 }, { 2400, 28, 11 }, { 2800, 31, 8 }, { 3200, 31, 5 }, { 3600, 31, 2 }, { 0, 0, 0 }
+};
+
+static unsigned char ay_regs[AY_REG_COUNT];      // Копия регистров, выводится целиком
+
+// Все регистры подряд: ~70 тактов на регистр
+static void ay_write() __naked {
+  __asm
+    ld hl, #_ay_regs
+    xor a
+00001$:
+    ld bc, #0xfffd
+    out (c), a                  ; Номер регистра
+    ld b, #0xc0
+    outi                        ; B уменьшается до вывода: порт 0xBFFD
+    inc a
+    cp #AY_REG_COUNT
+    jr nz, 00001$
+    ret
+  __endasm;
+}
+
+// Не больше одной новой ноты за кадр: длительности не короче кадра
+static void channel_frame(t_channel *p_ch, unsigned char *p_tone, unsigned char *p_volume) {
+  unsigned char note;
+  unsigned int period;
+
+  if (p_ch->left == 0) {
+    if (*p_ch->p_next == SONG_LOOP) p_ch->p_next = p_ch->p_start;
+    note = *p_ch->p_next++;
+    p_ch->left = *p_ch->p_next++;
+    if (note == REST) {
+      p_ch->volume = 0;
+    } else {
+      period = note_periods[note - 1];
+      p_tone[0] = period & 0xff;
+      p_tone[1] = period >> 8;
+      p_ch->volume = p_ch->attack;
+    }
+  } else if (p_ch->volume > p_ch->sustain) {
+    p_ch->volume--;
+  }
+  p_ch->left--;
+  *p_volume = p_ch->volume;
+}
+#else
+// === ЭФФЕКТЫ БИПЕРА ===
+// Полупериод — 13 * period + 41 тактов; cycles полупериодов за кадр
+// (чётное число: динамик остаётся в исходном положении). Каждый кадр
+// эффекта укладывается в SOUND_BEEPER_BUDGET.
+typedef struct {
+  unsigned char period;
+  unsigned char cycles;                          // 0 — конец эффекта
+} t_sfx_frame;
+
+static const t_sfx_frame sfx_step[] = {
+  { 20, 8 }, { 28, 6 }, { 0, 0 }                 // 2408 и 2430 тактов
+};
+static const t_sfx_frame sfx_bump[] = {
+  { 100, 2 }, { 110, 2 }, { 90, 2 }, { 0, 0 }    // Не больше 2942 тактов
+};
+
+// Параметры щелчков (передаются через память)
+static unsigned char beep_period;
+static unsigned char beep_cycles;
+static unsigned char beep_border;
+
+static void beep() __naked {
+  __asm
+    ld a, (_beep_period)
+    ld d, a
+    ld a, (_beep_cycles)
+    ld c, a
+    ld a, (_beep_border)
+00001$:
+    xor #0x10                   ; Бит динамика
+    out (#0xfe), a
+    ld b, d
+00002$:
+    djnz 00002$
+    dec c
+    jr nz, 00001$
+    ret
+  __endasm;
+}
+#endif
+
+static const t_sfx_frame * const sfx_table[SFX_COUNT] = { sfx_step, sfx_bump };
+static const t_sfx_frame *p_sfx;                 // Кадр текущего эффекта или 0
+
+static void reset() {
+#if SOUND_MODE == SOUND_AY
+  for (unsigned char i = 0; i < 2; i++) {
+    channels[i].p_next = channels[i].p_start;
+    channels[i].left = 0;
+    channels[i].volume = 0;
+  }
+  for (unsigned char i = 0; i < AY_REG_COUNT; i++) ay_regs[i] = 0;
+#endif
+  p_sfx = 0;
+  sfx_request = 0;
+}
+
+static void update() {
+  // Запрос эффекта — один байт, поэтому sound_play() не запрещает прерывания
+  if (sfx_request) {
+    p_sfx = sfx_table[sfx_request - 1];
+    sfx_request = 0;
+  }
+#if SOUND_MODE == SOUND_AY
+  unsigned char mixer = 0x3c;                    // Тоны A и B, шум выключен
+
+  channel_frame(&channels[0], &ay_regs[0], &ay_regs[8]);
+  channel_frame(&channels[1], &ay_regs[2], &ay_regs[9]);
+  ay_regs[10] = 0;
+  if (p_sfx && p_sfx->volume == 0) p_sfx = 0;
+  if (p_sfx) {
+    if (p_sfx->tone) {
+      ay_regs[4] = p_sfx->tone & 0xff;
+      ay_regs[5] = p_sfx->tone >> 8;
+      mixer &= ~0x04;
+    }
+    if (p_sfx->noise) {
+      ay_regs[6] = p_sfx->noise;
+      mixer &= ~0x20;
+    }
+    ay_regs[10] = p_sfx->volume;
+    p_sfx++;
+  }
+  ay_regs[7] = mixer;
+  ay_write();
+#else
+  if (p_sfx && p_sfx->cycles == 0) p_sfx = 0;
+  if (!p_sfx) return;
+  beep_period = p_sfx->period;
+  beep_cycles = p_sfx->cycles;
+  beep_border = SOUND_BORDER;
+  beep();
+  p_sfx++;
+#endif
+}
+
+#if PROFILE_OVERLAY
+// Сколько обновлений с эффектом укладывается в один кадр прерывания;
+// сам обработчик прерывания тоже попадает в замер, поэтому оценка сверху
+static unsigned char measure_calls() {
+  unsigned int start = frame_counter;
+  unsigned char calls = 0;
+
+  while (frame_counter == start);
+  start = frame_counter;
+  while (frame_counter == start && calls != 0xff) {
+    sound_play(SFX_BUMP);
+    update();
+    calls++;
+  }
+  return calls;
+}
+#endif
+
+void sound_init() {
+  reset();
+#if PROFILE_OVERLAY
+  profile_audio(measure_calls());
+  reset();
+#endif
+  playing = 1;
+}
+
+void sound_play(unsigned char effect) {
+  sfx_request = effect + 1;
+}
+
+void sound_frame() {
+  if (!playing) return;
+#if PROFILE_OVERLAY
+  ula_port = PROFILE_AUDIO_COLOR;                // Полоса звука на бордюре
+  update();
+  ula_port = profile_border;
+#else
+  update();
+#endif
+}
+#endif
@@ -0,0 +1,37 @@
+#ifndef __SOUND_H
+#define __SOUND_H
+
+// === ЗВУК ИЗ КАДРОВОГО ПРЕРЫВАНИЯ ===
+// Всё обновление звука — sound_frame() из обработчика IM 2, один раз за
+// кадр, поэтому engine_render() его не ждёт. Стоимость кадра ограничена:
+// не больше одной новой ноты на канал и одного шага эффекта, затем вывод
+// всех регистров без условий.
+// SOUND_AY: музыка на каналах A и B AY-3-8912 (128K), эффекты — на C.
+// На 48K порты AY не декодируются, сборка просто молчит.
+// SOUND_BEEPER: только эффекты щелчками динамика, не больше
+// SOUND_BEEPER_BUDGET тактов за кадр; музыке бипер занял бы весь процессор.
+#define SOUND_OFF 0
+#define SOUND_AY 1
+#define SOUND_BEEPER 2
+#ifndef SOUND_MODE
+#define SOUND_MODE SOUND_OFF
+#endif
+
+#define AY_REG_COUNT 11                // Тоны, шум, микшер, громкости (R0–R10)
+#define AY_CLOCK 1773400               // Тактовая AY в 128K, Гц
+#define SOUND_BEEPER_BUDGET 3000       // Такты бипера за кадр, ~4% кадра 48K
+
+// Эффекты
+#define SFX_STEP 0                     // Шаг
+#define SFX_BUMP 1                     // Удар о стену
+#define SFX_COUNT 2
+
+#if SOUND_MODE != SOUND_OFF
+void sound_init();                     // После irq_init(): замер стоимости, старт музыки
+void sound_frame();                    // Кадр звука (из обработчика прерывания)
+void sound_play(unsigned char effect); // Эффект с начала, прерывает текущий
+#else
+#define sound_play(effect)
+#endif
+
+#endif // __SOUND_H
@@ -0,0 +1,48 @@
+#include <string.h>
+#include "engine.h"
+#include "text.h"
+
+extern char screen_buf[];
+extern char attr_buf[];
+#if SHADOW_SCREEN
+extern char shadow_screen_buf[];
+#endif
+
+// Строка 16–23 лежит в третьей трети экрана: 8 линий символа через 256 байт
+static void put_char(unsigned char row, unsigned char col, char c) {
+  const unsigned char *p_glyph = (const unsigned char *)TEXT_FONT + (c - 32) * 8;
+  unsigned int offset = 0x1000 + ((row & 7) << 5) + col;
+
+  for (unsigned char line = 0; line < 8; line++) {
+    screen_buf[offset] = *p_glyph;
+#if SHADOW_SCREEN
+    shadow_screen_buf[offset] = *p_glyph;
+#endif
+    p_glyph++;
+    offset += 0x100;
+  }
+}
+
+void text_put_string(unsigned char row, unsigned char col, const char *s) {
+  while (*s) put_char(row, col++, *s++);
+}
+
+void text_put_uint(unsigned char row, unsigned char col, unsigned int value) {
+  char text[6];
+  unsigned char i = 5;
+
+  text[5] = 0;
+  do {
+    text[--i] = '0' + value % 10;
+    value /= 10;
+  } while (value);
+  while (i) text[--i] = ' ';
+  text_put_string(row, col, text);
+}
+
+void text_set_row_attr(unsigned char row, unsigned char attr) {
+  memset(attr_buf + row * SCR_WIDTH, attr, SCR_WIDTH);
+#if SHADOW_SCREEN
+  memset(shadow_screen_buf + 0x1800 + row * SCR_WIDTH, attr, SCR_WIDTH);
+#endif
+}
@@ -0,0 +1,15 @@
+#ifndef __TEXT_H
+#define __TEXT_H
+
+// === ТЕКСТ В НИЖНЕЙ ТРЕТИ ЭКРАНА ===
+// Рендер занимает строки 0–15, строки 16–23 свободны под служебный вывод
+// (профилировщик, отчёт демо). В режиме SHADOW_SCREEN текст пишется в оба
+// экрана, чтобы не мигать при переключении.
+#define TEXT_FIRST_ROW 16              // Первая строка нижней трети (из 24)
+#define TEXT_FONT 0x3d00               // Шрифт ПЗУ: символы 32–127 по 8 байт
+
+void text_put_string(unsigned char row, unsigned char col, const char *s);
+void text_put_uint(unsigned char row, unsigned char col, unsigned int value); // 5 знаков, выравнивание вправо
+void text_set_row_attr(unsigned char row, unsigned char attr);
+
+#endif // __TEXT_H
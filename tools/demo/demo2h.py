@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+import argparse
+import re
+import sys
+
+# Конвертер записей ввода (демо) в demo_data.h для режима DEMO_PLAYBACK.
+#
+# Запись — серии «клавиши, повторы» (demo.h) после двух байт длины. Вход:
+#  - .tap — лента, выгруженная demo_save() в режиме DEMO_RECORD (блок CODE "demo");
+#  - .bin — дамп памяти эмулятора с адреса DEMO_BUFFER_START (0xDB00);
+#  - .txt — сценарий вручную: строки "клавиши повторы", клавиши — буквы
+#    U D L R F (вперёд, назад, влево, вправо, огонь), '#' — комментарий.
+#
+# С --path шаги прогоняются через ту же логику, что update_player() в
+# main.c, и пишутся как сценарий камеры для tools/host/render_bench:
+# один кадр на шаг, как при воспроизведении.
+
+KEY_BITS = {"R": 0x02, "L": 0x01, "U": 0x04, "D": 0x08, "F": 0x10}
+MAX_RUN = 255
+BUFFER_SIZE = 0x300        # DEMO_BUFFER_SIZE
+HEADER_SIZE = 2            # Длина серий (младший байт первым)
+
+# Движение игрока (main.c)
+TURN_STEP = 2
+MOVE_SHIFT = 3
+START = (2 * 256, 2 * 256, 0)
+
+def runs_from_block(data):
+    length = data[0] | (data[1] << 8)
+    body = data[HEADER_SIZE:HEADER_SIZE + length]
+    if length % 2 or len(body) != length:
+        raise ValueError(f"bad demo block: length {length}, {len(data)} bytes")
+    return [(body[i], body[i + 1]) for i in range(0, length, 2)]
+
+def read_tap(path):
+    """Данные блока CODE "demo" с ленты."""
+    with open(path, "rb") as f:
+        tap = f.read()
+    pos, want = 0, False
+    while pos + 2 <= len(tap):
+        size = tap[pos] | (tap[pos + 1] << 8)
+        block = tap[pos + 2:pos + 2 + size]
+        pos += 2 + size
+        if block[0] == 0x00 and block[1] == 3:
+            want = block[2:12].decode("ascii", "replace").rstrip() == "demo"
+        elif block[0] == 0xff and want:
+            return block[1:-1]
+    raise ValueError(f"{path}: no CODE block named \"demo\"")
+
+def read_script(path):
+    runs = []
+    with open(path, "r") as f:
+        for line in f:
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            keys, count = line.split()
+            bits = 0
+            for k in keys.upper():
+                bits |= KEY_BITS[k]
+            count = int(count)
+            while count > 0:
+                runs.append((bits, min(count, MAX_RUN)))
+                count -= MAX_RUN
+    return runs
+
+def parse_sine(path):
+    with open(path, "r") as f:
+        text = f.read()
+    body = text[text.index("sine[256]"):]
+    body = re.sub(r"/\*.*?\*/", "", body[body.index("{") + 1:body.index("}")])
+    return [int(v) for v in body.split(",") if v.strip()]
+
+def parse_map(path):
+    rows = []
+    with open(path, "r") as f:
+        for line in f:
+            m = re.match(r"\s*\{([0-9,\s]+)\}", line)
+            if m:
+                rows.append([int(v) for v in m.group(1).split(",") if v.strip()])
+    return rows
+
+def write_path(runs, path, sine, rows):
+    """Сценарий камеры: позиция после каждого шага, как в update_player()."""
+    x, y, angle = START
+    with open(path, "w") as f:
+        f.write("# demo playback: one render per recorded step (tools/demo/demo2h.py)\n")
+        f.write("# x y angle (8.8, 0-255)\n")
+        f.write(f"{x} {y} {angle}\n")
+        for keys, count in runs:
+            for _ in range(count):
+                if keys & KEY_BITS["L"]:
+                    angle -= TURN_STEP
+                if keys & KEY_BITS["R"]:
+                    angle += TURN_STEP
+                angle &= 0xff
+                if keys & (KEY_BITS["U"] | KEY_BITS["D"]):
+                    dx = sine[(angle + 64) & 0xff] >> MOVE_SHIFT
+                    dy = sine[angle] >> MOVE_SHIFT
+                    if keys & KEY_BITS["U"]:
+                        px, py = x + dx, y + dy
+                    else:
+                        px, py = x - dx, y - dy
+                    if rows[py >> 8][px >> 8] == 0:
+                        x, y = px, py
+                f.write(f"{x} {y} {angle}\n")
+
+def write_header(runs, path, source):
+    body = [b for run in runs for b in run]
+    data = [len(body) & 0xff, len(body) >> 8] + body
+    if len(data) > BUFFER_SIZE:
+        raise ValueError(f"demo is {len(data)} bytes, buffer holds {BUFFER_SIZE}")
+    steps = sum(count for _, count in runs)
+    with open(path, "w") as f:
+        f.write("#ifndef __DEMO_DATA_H\n#define __DEMO_DATA_H\n\n")
+        f.write(f"// Сгенерировано tools/demo/demo2h.py из {source} — не редактировать.\n")
+        f.write(f"// {len(runs)} серий, {steps} шагов (~{steps / 50:.1f} с при 50 шагах в секунду).\n")
+        f.write("static const unsigned char demo_data[] = {\n")
+        for i in range(0, len(data), 16):
+            line = ",".join(f"0x{b:02x}" for b in data[i:i + 16])
+            f.write(f"  {line}{',' if i + 16 < len(data) else ''}\n")
+        f.write("};\n\n#endif // __DEMO_DATA_H\n")
+    return steps
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a recorded demo into demo_data.h")
+    parser.add_argument("input", help=".tap from demo_save(), .bin memory dump or .txt script")
+    parser.add_argument("output", help="demo_data.h")
+    parser.add_argument("--path", help="also write a render_bench camera path")
+    parser.add_argument("--sincos", default="sincos.h")
+    parser.add_argument("--map", default="map.h")
+    args = parser.parse_args()
+
+    try:
+        if args.input.endswith(".tap"):
+            runs = runs_from_block(read_tap(args.input))
+        elif args.input.endswith(".txt"):
+            runs = read_script(args.input)
+        else:
+            with open(args.input, "rb") as f:
+                runs = runs_from_block(f.read())
+        steps = write_header(runs, args.output, args.input)
+        if args.path:
+            write_path(runs, args.path, parse_sine(args.sincos), parse_map(args.map))
+    except (OSError, ValueError, KeyError) as e:
+        print(f"❌ {e}", file=sys.stderr)
+        return 1
+    print(f"✅ Generated {args.output} ({len(runs)} runs, {steps} steps).")
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -77,15 +77,126 @@ def c_array_literal(data, name, const=True):
     lines.append("};")
     return "\n".join(lines)
 
-def generate_header(sprites_info, output_h, include_attributes):
+# Формат LZ описан в unpack.h
+LZ_MAX_LITERALS = 128
+LZ_MIN_MATCH = 3
+LZ_MAX_MATCH = 129
+LZ_MAX_OFFSET = 256
+LZ_END = 0xFF
+
+def pack_lz(data):
+    """Жадное LZ-сжатие в байтовый формат распаковщика lz_unpack()."""
+    out = bytearray()
+    literals = bytearray()
+
+    def flush_literals():
+        for i in range(0, len(literals), LZ_MAX_LITERALS):
+            chunk = literals[i:i + LZ_MAX_LITERALS]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+        literals.clear()
+
+    pos = 0
+    while pos < len(data):
+        best_len, best_off = 0, 0
+        for off in range(1, min(LZ_MAX_OFFSET, pos) + 1):
+            length = 0
+            # Повтор может перекрываться с собой (копирование побайтно вперёд)
+            while (length < LZ_MAX_MATCH and pos + length < len(data)
+                   and data[pos + length] == data[pos + length - off]):
+                length += 1
+            if length > best_len:
+                best_len, best_off = length, off
+        if best_len >= LZ_MIN_MATCH:
+            flush_literals()
+            out.append(0x80 | (best_len - LZ_MIN_MATCH))
+            out.append((LZ_MAX_OFFSET - best_off) & 0xFF)
+            pos += best_len
+        else:
+            literals.append(data[pos])
+            pos += 1
+    flush_literals()
+    out.append(LZ_END)
+    return bytes(out)
+
+def unpack_lz(packed):
+    """Эталонная распаковка для проверки упаковщика."""
+    out = bytearray()
+    pos = 0
+    while packed[pos] != LZ_END:
+        token = packed[pos]
+        if token & 0x80:
+            off = LZ_MAX_OFFSET - packed[pos + 1]
+            for _ in range((token & 0x7F) + LZ_MIN_MATCH):
+                out.append(out[-off])
+            pos += 2
+        else:
+            out.extend(packed[pos + 1:pos + 2 + token])
+            pos += 2 + token
+    return bytes(out)
+
+def c_packed_literal(data, name):
+    """Сжатый блоб плюс проверка, что он распаковывается в исходные данные."""
+    packed = pack_lz(data)
+    if unpack_lz(packed) != data:
+        raise ValueError(f"LZ round trip failed for {name}")
+    return packed, c_array_literal(packed, name)
+
+def c_column_routines(name, pixels, w, h):
+    """Развёрнутая запись столбцов спрайта: по функции на столбец (x % width).
+
+    Функция пишет первые rows строк столбца в буфер с шагом 32 байта.
+    Вход в switch — сразу на нужное число строк, дальше провал по case
+    от последней строки к первой (как в устройстве Даффа). Нулевые байты
+    тоже пишутся: под столбцом может остаться изображение прошлого кадра.
+    """
+    lines = []
+    rows = h * 8
+    for col in range(w):
+        lines.append(f"static void {name}_column_{col}(char *p_buf, unsigned char rows) {{")
+        lines.append("    switch (rows) {")
+        for row in range(rows - 1, -1, -1):
+            lines.append(f"    case {row + 1}: p_buf[{row * SCREEN_WIDTH_CHARS}] = 0x{pixels[row * w + col]:02X};")
+        lines.append("    }")
+        lines.append("}")
+        lines.append("")
+    cols = ", ".join(f"{name}_column_{col}" for col in range(w))
+    lines.append(f"static const t_column_fn {name}_columns[] = {{ {cols} }};")
+    return "\n".join(lines)
+
+def generate_header(sprites_info, output_h, include_attributes, compress=False, screens=()):
     with open(output_h, "w") as f:
         f.write("#ifndef SPRITES_H\n")
         f.write("#define SPRITES_H\n\n")
         f.write("#include <stddef.h>\n\n")
 
+        if compress:
+            # Пиксели спрайтов хранятся сжатыми; engine_init() распаковывает их в ОЗУ.
+            # С BANKED_ASSETS блобы распаковываются сразу в банки (calc_banked_sprites()),
+            # резидентных массивов нет и описатели получают адрес при подгрузке.
+            f.write("#define SPRITES_PACKED 1\n\n")
+            f.write("#ifndef BANKED_ASSETS\n")
+            f.write("#define BANKED_ASSETS 0\n")
+            f.write("#endif\n")
+            f.write("#if BANKED_ASSETS\n")
+            f.write("#define SPRITE_PIXELS(data) NULL\n")
+            f.write("#else\n")
+            f.write("#define SPRITE_PIXELS(data) data\n")
+            f.write("#endif\n\n")
+
+        compiled = any(info["compiled"] for info in sprites_info)
+        if compiled:
+            # Развёрнутые столбцы занимают много ПЗУ, поэтому включаются при сборке
+            f.write("#ifndef COMPILED_COLUMNS\n")
+            f.write("#define COMPILED_COLUMNS 0\n")
+            f.write("#endif\n\n")
+
+        f.write("typedef void (*t_column_fn)(char *p_buf, unsigned char rows);\n\n")
+
         f.write("typedef struct {\n")
         f.write("    const unsigned char *p_sprite;\n")
         f.write("    const unsigned char *p_attributes;\n")
+        f.write("    const t_column_fn *p_columns;\n")
         f.write("    unsigned char width;\n")
         f.write("    unsigned char height;\n")
         f.write("} t_sprite;\n\n")
@@ -99,22 +210,46 @@ def generate_header(sprites_info, output_h, include_attributes):
             h = info["height"]
 
             # Генерируем массивы
-            pixel_preamble = f"/*{{w:{w*8},h:{h*8},bpp:1,brev:1}}*/"
-            pixel_lines = c_array_literal(pixels, f"{name}_sprite_data").split('\n')
-            pixel_lines[0] = pixel_lines[0][:-1] + pixel_preamble  # заменяем "{" на "{/*...*/"
-            pixel_lines[0] += "{"
-            f.write('\n'.join(pixel_lines) + "\n\n")
+            if compress:
+                packed, packed_literal = c_packed_literal(pixels, f"{name}_sprite_lz")
+                info["packed_size"] = len(packed)
+                f.write("#if !BANKED_ASSETS\n")
+                f.write(f"unsigned char {name}_sprite_data[{len(pixels)}];  // Заполняется lz_unpack()\n")
+                f.write("#endif\n")
+                f.write(packed_literal + "\n\n")
+            else:
+                pixel_preamble = f"/*{{w:{w*8},h:{h*8},bpp:1,brev:1}}*/"
+                pixel_lines = c_array_literal(pixels, f"{name}_sprite_data").split('\n')
+                pixel_lines[0] = pixel_lines[0][:-1] + pixel_preamble  # заменяем "{" на "{/*...*/"
+                pixel_lines[0] += "{"
+                f.write('\n'.join(pixel_lines) + "\n\n")
 
             if include_attributes:
                 f.write(c_array_literal(attrs, f"{name}_attr_data") + "\n\n")
 
+            if info["compiled"]:
+                f.write("#if COMPILED_COLUMNS\n")
+                f.write(c_column_routines(name, pixels, w, h) + "\n")
+                f.write("#endif\n\n")
+
             # Объявление структуры
             f.write(f"static const t_sprite {name} = {{\n")
-            f.write(f"    .p_sprite = {name}_sprite_data,\n")
+            if compress:
+                f.write(f"    .p_sprite = SPRITE_PIXELS({name}_sprite_data),\n")
+            else:
+                f.write(f"    .p_sprite = {name}_sprite_data,\n")
             if include_attributes:
                 f.write(f"    .p_attributes = {name}_attr_data,\n")
             else:
                 f.write("    .p_attributes = NULL,\n")
+            if info["compiled"]:
+                f.write("#if COMPILED_COLUMNS\n")
+                f.write(f"    .p_columns = {name}_columns,\n")
+                f.write("#else\n")
+                f.write("    .p_columns = NULL,\n")
+                f.write("#endif\n")
+            else:
+                f.write("    .p_columns = NULL,\n")
             f.write(f"    .width = {w},\n")
             f.write(f"    .height = {h}\n")
             f.write("};\n\n")
@@ -129,6 +264,26 @@ def generate_header(sprites_info, output_h, include_attributes):
             f.write("};\n\n")
             f.write(f"static const size_t num_sprites = {len(all_decls)};\n\n")
 
+        if compress:
+            # Таблица распаковки: блоб, приёмник и размер данных
+            f.write("typedef struct {\n")
+            f.write("    const unsigned char *p_packed;\n")
+            f.write("    unsigned char *p_data;\n")
+            f.write("    unsigned int size;\n")
+            f.write("    unsigned int packed_size;\n")
+            f.write("} t_packed;\n\n")
+            f.write("static const t_packed packed_sprites[] = {\n")
+            for info in sprites_info:
+                name = info["name"]
+                f.write(f"    {{ {name}_sprite_lz, SPRITE_PIXELS({name}_sprite_data), {len(info['pixels'])}, {info['packed_size']} }},\n")
+            f.write("};\n\n")
+            f.write(f"static const size_t num_packed_sprites = {len(sprites_info)};\n\n")
+
+        # Сжатые экраны (6912 байт: пиксели + атрибуты), распаковываются прямо в 0x4000
+        for scr in screens:
+            packed, packed_literal = c_packed_literal(scr["data"], f"{scr['name']}_lz")
+            f.write(packed_literal + "\n\n")
+
         f.write("#endif // SPRITES_H\n")
 
 def main():
@@ -173,12 +328,26 @@ def main():
             "pixels": pixels,
             "attrs": attrs,
             "width": w,
-            "height": h
+            "height": h,
+            # Развёрнутые процедуры записи столбцов (см. c_column_routines)
+            "compiled": spr.get("compiled", False)
         })
 
-    generate_header(sprites_info, output_h, include_attributes)
+    # Сжатие пикселей спрайтов (LZ, распаковка в engine_init) — по умолчанию выключено
+    compress = manifest.get("compress", False)
+
+    screens = []
+    for scr in manifest.get("screens", []):
+        with open(scr["file"], "rb") as f:
+            screens.append({"name": scr["name"], "data": f.read()})
+
+    generate_header(sprites_info, output_h, include_attributes, compress, screens)
     attr_state = "with" if include_attributes else "without"
     print(f"✅ Generated {output_h} {attr_state} attributes ({len(sprites_info)} sprites).")
+    if compress:
+        raw = sum(len(info["pixels"]) for info in sprites_info)
+        packed = sum(info["packed_size"] for info in sprites_info)
+        print(f"   sprite pixels packed: {raw} -> {packed} bytes")
 
 if __name__ == "__main__":
     main()
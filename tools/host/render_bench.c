@@ -0,0 +1,220 @@
+// Хостовый стенд для движка: проигрывает сценарий камеры, сверяет хэши кадров
+// с эталонами и замеряет время этапов engine_render().
+//
+// Использование: render_bench [-r повторов] [-w] [-d экран.scr] <сценарий.path> <эталон.golden>
+//   -r N     проиграть сценарий N раз (эталоны сверяются только на первом проходе)
+//   -w       записать эталонные хэши вместо сверки
+//   -d file  сохранить последний кадр первого прохода (6912 байт, .scr)
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Движок собирается в той же единице трансляции: так стенду доступны его
+// внутренние буферы, а заголовки с данными не дублируются при линковке.
+// int у SDCC 16-битный: на время сборки движка int — это short, так что
+// переменные и аккумуляторы переполняются и переносятся как на Z80
+#define int short
+#include "engine.c"
+#include "unpack.c"
+#include "bank.c"
+#undef int
+
+#define MAX_FRAMES 4096
+
+typedef struct {
+  int x;
+  int y;
+  int angle;
+} t_camera;
+
+static t_camera frames[MAX_FRAMES];
+static unsigned long hashes[MAX_FRAMES];
+static int num_frames;
+
+static const char *stage_names[STAGE_COUNT] = {
+  "trace_ray", "smooth_lr", "smooth_rl", "draw_wall", "draw_objects", "copy_pix_buf"
+};
+
+// === ТАЙМЕР ЭТАПОВ ===
+static double stage_ns[STAGE_COUNT];
+static int current_stage = STAGE_COUNT;
+static struct timespec stage_start;
+
+void host_profile_stage(int stage) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  if (current_stage < STAGE_COUNT) {
+    stage_ns[current_stage] += (now.tv_sec - stage_start.tv_sec) * 1e9
+                             + (now.tv_nsec - stage_start.tv_nsec);
+  }
+  current_stage = stage;
+  stage_start = now;
+}
+
+#if SHADOW_SCREEN
+// Кадр виден сразу после переключения: ожидать прерывание не нужно
+void irq_wait_frame() {
+}
+
+// Показан экран, противоположный заднему
+#define VISIBLE_PIXELS (back_screen ? screen_buf : shadow_screen_buf)
+#define VISIBLE_ATTRS  (back_screen ? attr_buf : shadow_screen_buf + 0x1800)
+#else
+#define VISIBLE_PIXELS screen_buf
+#define VISIBLE_ATTRS  attr_buf
+#endif
+
+// === ХЭШ ЭКРАНА (FNV-1a по 6912 байтам: пиксели + атрибуты) ===
+static unsigned long hash_screen() {
+  const char *pixels = VISIBLE_PIXELS, *attrs = VISIBLE_ATTRS;
+  unsigned long h = 2166136261UL;
+  for (int i = 0; i < 0x1800; i++) h = ((h ^ (unsigned char)pixels[i]) * 16777619UL) & 0xffffffffUL;
+  for (int i = 0; i < 0x300; i++) h = ((h ^ (unsigned char)attrs[i]) * 16777619UL) & 0xffffffffUL;
+  return h;
+}
+
+static int dump_screen(const char *file_name) {
+  FILE *f = fopen(file_name, "wb");
+  if (!f) {
+    perror(file_name);
+    return 0;
+  }
+  fwrite(VISIBLE_PIXELS, 1, 0x1800, f);
+  fwrite(VISIBLE_ATTRS, 1, 0x300, f);
+  fclose(f);
+  return 1;
+}
+
+// === ЧТЕНИЕ СЦЕНАРИЯ: строки "x y angle", '#' — комментарий ===
+static int load_path(const char *file_name) {
+  char line[256];
+  FILE *f = fopen(file_name, "r");
+  if (!f) {
+    perror(file_name);
+    return 0;
+  }
+  num_frames = 0;
+  while (fgets(line, sizeof(line), f)) {
+    t_camera *cam = &frames[num_frames];
+    if (line[0] == '#' || line[0] == '\n') continue;
+    if (sscanf(line, "%d %d %d", &cam->x, &cam->y, &cam->angle) != 3) {
+      fprintf(stderr, "%s: bad line: %s", file_name, line);
+      fclose(f);
+      return 0;
+    }
+    if (++num_frames == MAX_FRAMES) break;
+  }
+  fclose(f);
+  return num_frames > 0;
+}
+
+static int save_goldens(const char *file_name) {
+  FILE *f = fopen(file_name, "w");
+  if (!f) {
+    perror(file_name);
+    return 0;
+  }
+  for (int i = 0; i < num_frames; i++) fprintf(f, "%08lx\n", hashes[i]);
+  fclose(f);
+  return 1;
+}
+
+static int check_goldens(const char *file_name) {
+  char line[64];
+  int frame = 0, failed = 0;
+  FILE *f = fopen(file_name, "r");
+  if (!f) {
+    perror(file_name);
+    return 0;
+  }
+  while (fgets(line, sizeof(line), f) && frame < num_frames) {
+    unsigned long golden = strtoul(line, NULL, 16);
+    if (golden != hashes[frame]) {
+      fprintf(stderr, "frame %d: hash %08lx, expected %08lx\n", frame, hashes[frame], golden);
+      failed++;
+    }
+    frame++;
+  }
+  fclose(f);
+  if (frame != num_frames) {
+    fprintf(stderr, "%s: %d goldens for %d frames\n", file_name, frame, num_frames);
+    return 0;
+  }
+  return failed == 0;
+}
+
+int main(int argc, char *argv[]) {
+  int repeats = 1;
+  int write_goldens = 0;
+  const char *dump_file = NULL;
+  int opt = 1;
+  double total_ns = 0;
+  struct timespec init_start, init_end;
+
+  for (; opt < argc && argv[opt][0] == '-'; opt++) {
+    if (!strcmp(argv[opt], "-w")) write_goldens = 1;
+    else if (!strcmp(argv[opt], "-r") && opt + 1 < argc) repeats = atoi(argv[++opt]);
+    else if (!strcmp(argv[opt], "-d") && opt + 1 < argc) dump_file = argv[++opt];
+    else break;
+  }
+  if (argc - opt != 2 || repeats < 1) {
+    fprintf(stderr, "Usage: %s [-r repeats] [-w] [-d screen.scr] <path> <golden>\n", argv[0]);
+    return 2;
+  }
+  if (!load_path(argv[opt])) return 2;
+
+  clock_gettime(CLOCK_MONOTONIC, &init_start);
+  engine_init();
+  clock_gettime(CLOCK_MONOTONIC, &init_end);
+#ifdef BENCH_RAY_STEP
+  // Все кадры сценария — в движении: постоянный грубый шаг
+  engine_set_ray_step(BENCH_RAY_STEP);
+#endif
+#ifdef BENCH_OBJECTS
+  // Объекты в коридорах, которые проходят сценарии
+  object_add(5 * 256 + 128, 2 * 256 + 128, 1);
+  object_add(4 * 256 + 128, 1 * 256 + 128, 2);
+  object_add(9 * 256 + 128, 6 * 256 + 128, 0);
+  object_add(2 * 256 + 128, 8 * 256 + 128, 2);
+#endif
+  for (int run = 0; run < repeats; run++) {
+    for (int i = 0; i < num_frames; i++) {
+      engine_render(frames[i].x, frames[i].y, frames[i].angle);
+      if (run == 0) hashes[i] = hash_screen();
+    }
+    if (run == 0 && dump_file && !dump_screen(dump_file)) return 2;
+  }
+
+  if (write_goldens) {
+    if (!save_goldens(argv[opt + 1])) return 2;
+  } else if (!check_goldens(argv[opt + 1])) {
+    fprintf(stderr, "%s: FAILED\n", argv[opt]);
+    return 1;
+  }
+
+  for (int s = 0; s < STAGE_COUNT; s++) total_ns += stage_ns[s];
+  printf("%s: %d frames x %d runs, %s\n", argv[opt], num_frames, repeats,
+         write_goldens ? "goldens written" : "goldens OK");
+  for (int s = 0; s < STAGE_COUNT; s++) {
+    printf("  %-14s %10.2f us/frame %6.1f%%\n", stage_names[s],
+           stage_ns[s] / 1000.0 / (num_frames * repeats),
+           total_ns > 0 ? stage_ns[s] * 100.0 / total_ns : 0.0);
+  }
+  printf("  %-14s %10.2f us/frame\n", "total", total_ns / 1000.0 / (num_frames * repeats));
+  printf("  %-14s %10.2f us\n", "engine_init", (init_end.tv_sec - init_start.tv_sec) * 1e6
+                                               + (init_end.tv_nsec - init_start.tv_nsec) / 1000.0);
+#ifdef SPRITES_PACKED
+  {
+    unsigned int raw = 0, packed = 0;
+    for (size_t i = 0; i < num_packed_sprites; i++) {
+      raw += packed_sprites[i].size;
+      packed += packed_sprites[i].packed_size;
+    }
+    printf("  %-14s %6u -> %u bytes (LZ)\n", "sprite pixels", raw, packed);
+  }
+#endif
+  return 0;
+}
@@ -0,0 +1,21 @@
+#ifndef __ZX_HOST_H
+#define __ZX_HOST_H
+
+// Подключается принудительно (-include) при сборке движка на хосте (gcc/clang).
+// Убирает специфичные для SDCC конструкции и отображает память ZX Spectrum
+// на обычные массивы.
+
+// __at (адрес) — абсолютное размещение; на хосте массив размещает компилятор
+#define __at(addr)
+#define __sfr volatile unsigned char
+#define __banked
+
+// Адреса строк экрана пересчитываются относительно массива screen_buf
+extern char screen_buf[];
+#define SCR_ADDR(addr) (screen_buf + ((addr) - SCREEN_BUFFER_START))
+
+// Отметки этапов рендера ведут в таймер стенда
+void host_profile_stage(int stage);
+#define PROFILE_STAGE(stage) host_profile_stage(stage)
+
+#endif // __ZX_HOST_H
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+import re
+import sys
+from collections import deque
+
+# Генератор данных карты из map.h:
+#  - map_packed.h — карта по 2 или 4 бита на клетку; строка занимает степень
+#    двойки байт, поэтому адрес клетки собирается из старших байтов координат
+#    8.8 сдвигами, без умножения; только константы и объявления, без данных,
+#    поэтому подключается в любой модуль;
+#  - map_data.h — сами байты карты и таблицы клеток (подключает только engine.c);
+#  - map_dist.h — поле расстояний для trace_ray_skip(): для каждой клетки
+#    расстояние Чебышёва до ближайшей стены (0 — стена). Квадрат
+#    (2D - 1) x (2D - 1) клеток вокруг клетки с расстоянием D заведомо пуст.
+
+MAX_DIST = 64       # Ограничение сверху: 2 * D - 1 должно помещаться в байт
+MAX_MAP_SIDE = 128  # Координата клетки помещается в байт, луч не выходит за карту
+MIN_ROW_CELLS = 32  # Ширина строки упакованной карты — степень двойки не меньше этой
+MAX_PACKED_SIZE = 0x1e00  # От MAP_PACKED_START (0xA000) до таблицы IM 2 (0xBE00)
+
+def parse_map(path):
+    """Читает строки вида {1,0,0,...} из map.h."""
+    rows = []
+    with open(path, "r") as f:
+        for line in f:
+            m = re.match(r"\s*\{([0-9,\s]+)\}", line)
+            if m:
+                rows.append([int(v) for v in m.group(1).split(",") if v.strip()])
+    if not rows or any(len(r) != len(rows[0]) for r in rows):
+        raise ValueError(f"{path}: map rows not found or of different width")
+    return rows
+
+def chebyshev_distances(rows):
+    """Расстояние Чебышёва от каждой клетки до ближайшей стены (0 — стена)."""
+    h, w = len(rows), len(rows[0])
+    dist = [[None] * w for _ in range(h)]
+    queue = deque()
+    for y in range(h):
+        for x in range(w):
+            if rows[y][x]:
+                dist[y][x] = 0
+                queue.append((x, y))
+    # Волна от всех стен сразу по 8 соседям
+    while queue:
+        x, y = queue.popleft()
+        for dy in (-1, 0, 1):
+            for dx in (-1, 0, 1):
+                nx, ny = x + dx, y + dy
+                if 0 <= nx < w and 0 <= ny < h and dist[ny][nx] is None:
+                    dist[ny][nx] = dist[y][x] + 1
+                    queue.append((nx, ny))
+    return dist
+
+def cell_bits(rows):
+    """2 бита на клетку, если хватает (проход + 3 материала), иначе 4."""
+    top = max(max(r) for r in rows)
+    if top > 15:
+        raise ValueError(f"cell value {top} does not fit in 4 bits")
+    return 2 if top <= 3 else 4
+
+def generate_packed(rows, output_h, data_h):
+    h, w = len(rows), len(rows[0])
+    if w > MAX_MAP_SIDE or h > MAX_MAP_SIDE:
+        raise ValueError(f"map {w}x{h} is larger than {MAX_MAP_SIDE}x{MAX_MAP_SIDE}")
+    bits = cell_bits(rows)
+    per_byte = 8 // bits
+    # Ширина строки дополняется проходами до степени двойки
+    row_cells = MIN_ROW_CELLS
+    while row_cells < w:
+        row_cells *= 2
+    row_bytes = row_cells // per_byte
+    row_shift = row_bytes.bit_length() - 1
+    x_shift = per_byte.bit_length() - 1
+
+    data = []
+    for row in rows:
+        cells = row + [0] * (row_cells - w)
+        for i in range(0, row_cells, per_byte):
+            byte = 0
+            for j in range(per_byte):
+                byte |= cells[i + j] << (j * bits)   # Клетка 0 — младшие биты
+            data.append(byte)
+
+    if len(data) > MAX_PACKED_SIZE:
+        raise ValueError(f"packed map is {len(data)} bytes, only {MAX_PACKED_SIZE} fit")
+
+    mask = (1 << bits) - 1
+    with open(output_h, "w") as f:
+        f.write("#ifndef __MAP_PACKED_H\n")
+        f.write("#define __MAP_PACKED_H\n\n")
+        f.write("// Сгенерировано tools/mapgen/mapgen.py из map.h — не редактировать.\n")
+        f.write(f"// Бит на клетку: {bits}, клеток в байте: {per_byte}, клетка 0 — в младших битах.\n")
+        f.write(f"// Строка дополнена до {row_cells} клеток ({row_bytes} байт), вся карта — {len(data)} байт.\n")
+        f.write(f"#define MAP_WIDTH {w}\n")
+        f.write(f"#define MAP_HEIGHT {h}\n")
+        f.write(f"#define MAP_CELL_BITS {bits}\n")
+        f.write(f"#define MAP_CELL_MASK 0x{mask:02x}\n")
+        f.write(f"#define MAP_ROW_SHIFT {row_shift}           // log2(байт в строке)\n")
+        f.write(f"#define MAP_X_SHIFT {x_shift}             // log2(клеток в байте)\n")
+        f.write(f"#define MAP_X_MASK {per_byte - 1}              // Номер клетки внутри байта\n")
+        f.write(f"#define MAP_PACKED_SIZE {len(data)}\n\n")
+        f.write("// Карта лежит между кодом и таблицей IM 2 (0xBE00): до 7,5 КБ\n")
+        f.write("#ifndef MAP_PACKED_START\n")
+        f.write("#define MAP_PACKED_START 0xa000\n")
+        f.write("#endif\n\n")
+        f.write("// Маска и сдвиг клетки внутри байта по младшим битам X\n")
+        f.write("extern const unsigned char map_cell_masks[1 << MAP_X_SHIFT];\n")
+        f.write("extern const unsigned char map_cell_shifts[1 << MAP_X_SHIFT];\n\n")
+        f.write("// Начало карты выровнено по странице: старший байт адреса — база плюс\n")
+        f.write("// старшие биты Y, младший — остальные биты Y и X, без переносов\n")
+        f.write("extern const unsigned char map_packed[MAP_PACKED_SIZE];\n\n")
+        f.write("#endif // __MAP_PACKED_H\n")
+
+    with open(data_h, "w") as f:
+        f.write("#ifndef __MAP_DATA_H\n")
+        f.write("#define __MAP_DATA_H\n\n")
+        f.write("// Сгенерировано tools/mapgen/mapgen.py из map.h — не редактировать.\n")
+        f.write("// Данные карты для map_packed.h; подключается в одну единицу трансляции.\n")
+        masks = ",".join(f"0x{mask << (j * bits):02x}" for j in range(per_byte))
+        shifts = ",".join(str(j * bits) for j in range(per_byte))
+        f.write(f"const unsigned char map_cell_masks[{per_byte}] = {{{masks}}};\n")
+        f.write(f"const unsigned char map_cell_shifts[{per_byte}] = {{{shifts}}};\n\n")
+        f.write("const unsigned char __at (MAP_PACKED_START) map_packed[MAP_PACKED_SIZE] = {\n")
+        for y in range(h):
+            line = ",".join(f"0x{b:02x}" for b in data[y * row_bytes:(y + 1) * row_bytes])
+            f.write(f"  {line}{',' if y < h - 1 else ''}\n")
+        f.write("};\n\n")
+        f.write("#endif // __MAP_DATA_H\n")
+    return bits, len(data)
+
+def generate_header(rows, output_h):
+    dist = chebyshev_distances(rows)
+    with open(output_h, "w") as f:
+        f.write("#ifndef __MAP_DIST_H\n")
+        f.write("#define __MAP_DIST_H\n\n")
+        f.write("// Сгенерировано tools/mapgen/mapgen.py из map.h — не редактировать.\n")
+        f.write("// Расстояние Чебышёва от клетки до ближайшей стены (0 — стена).\n")
+        f.write("static const unsigned char map_dist[MAP_HEIGHT][MAP_WIDTH] = {\n")
+        for y, row in enumerate(dist):
+            line = ",".join(str(min(d, MAX_DIST)) for d in row)
+            f.write(f"  {{{line}}}{',' if y < len(dist) - 1 else ''}\n")
+        f.write("};\n\n")
+        f.write("#endif // __MAP_DIST_H\n")
+
+def main():
+    if len(sys.argv) != 5:
+        print("Usage: python3 mapgen.py <map.h> <map_dist.h> <map_packed.h> <map_data.h>")
+        sys.exit(1)
+
+    rows = parse_map(sys.argv[1])
+    generate_header(rows, sys.argv[2])
+    print(f"✅ Generated {sys.argv[2]} ({len(rows[0])}x{len(rows)} cells).")
+    bits, size = generate_packed(rows, sys.argv[3], sys.argv[4])
+    print(f"✅ Generated {sys.argv[3]}, {sys.argv[4]} ({bits} bits per cell, {size} bytes).")
+
+if __name__ == "__main__":
+    main()
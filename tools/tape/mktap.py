@@ -0,0 +1,490 @@
+#!/usr/bin/env python3
+import argparse
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "extractor"))
+from extractor import pack_lz, unpack_lz
+
+# Сборка ленты из ROM-образа 8bitworkshop (bin/main.c.rom, память с 0x5CCB).
+#
+# Лента: BASIC-загрузчик (стандартная скорость ПЗУ), затем два блока без
+# заголовков — сжатая заставка и сжатый код. Машинный код загрузчика лежит
+# в REM и переносится в буфер принтера (0x5B00) и в 0x8000 (быстрая
+# загрузка идёт из нескрываемой памяти, иначе такты цикла «плывут»).
+# Заставка распаковывается сразу в экран, код — на место, хвост образа
+# (нули) заполняется без загрузки.
+#
+#  - .tap — все блоки на скорости ПЗУ (LD-BYTES), годится для любого эмулятора;
+#  - .tzx — блоки заставки и кода в турбо-формате (блок 0x11) для своей
+#    процедуры загрузки, примерно в 2,4 раза быстрее ПЗУ.
+#
+# Для каждого блока печатается время загрузки с ленты в реальном времени.
+
+CPU_HZ = 3500000
+STACK_TOP = 0x5c00          # Стек загрузчика — верх буфера принтера
+STAGE_START = 0x5b00        # Загрузчик: буфер принтера
+TURBO_START = 0x8000        # Процедура турбо-загрузки: первая нескрываемая страница
+REM_CODE = 23760            # Код в REM строки 10: PROG (23755) + 5
+ROM_LD_BYTES = 0x0556
+MEMORY_TOP = 0x10000
+SCREEN_START = 0x4000
+SCREEN_SIZE = 6912
+
+# Импульсы ПЗУ (такты Z80)
+ROM_PILOT, ROM_SYNC1, ROM_SYNC2, ROM_ZERO, ROM_ONE = 2168, 667, 735, 855, 1710
+ROM_PILOT_HEADER, ROM_PILOT_DATA = 8063, 3223
+ROM_PAUSE_MS = 1000
+
+# Турбо-импульсы; пороги в TURBO_ASM подобраны под них (54 такта на отсчёт)
+TURBO_PILOT, TURBO_SYNC1, TURBO_SYNC2, TURBO_ZERO, TURBO_ONE = 1400, 400, 450, 350, 700
+TURBO_PILOT_COUNT = 1200    # Перекрывает распаковку предыдущего блока
+TURBO_PAUSE_MS = 100
+
+# === BASIC ===
+TOKEN_RANDOMIZE, TOKEN_USR, TOKEN_VAL, TOKEN_REM = 0xf9, 0xc0, 0xb0, 0xea
+
+def basic_line(number, body):
+    body = bytes(body) + b"\x0d"
+    return bytes([number >> 8, number & 0xff, len(body) & 0xff, len(body) >> 8]) + body
+
+def basic_stub(code):
+    """10 REM <код>: 20 RANDOMIZE USR VAL "23760" (автозапуск со строки 10)."""
+    return (basic_line(10, bytes([TOKEN_REM]) + code)
+            + basic_line(20, bytes([TOKEN_RANDOMIZE, TOKEN_USR, TOKEN_VAL]) + f'"{REM_CODE}"'.encode()))
+
+# === МИНИ-АССЕМБЛЕР Z80 ===
+# Только команды, которые нужны загрузчику. Два прохода: метки, затем коды.
+REGS = {"b": 0, "c": 1, "d": 2, "e": 3, "h": 4, "l": 5, "(hl)": 6, "a": 7}
+PAIRS = {"bc": 0, "de": 1, "hl": 2, "sp": 3}
+STACK_PAIRS = {"bc": 0, "de": 1, "hl": 2, "af": 3}
+CONDS = {"nz": 0, "z": 1, "nc": 2, "c": 3, "po": 4, "pe": 5, "p": 6, "m": 7}
+ALU = {"add": 0, "adc": 1, "sub": 2, "sbc": 3, "and": 4, "xor": 5, "or": 6, "cp": 7}
+SIMPLE = {"di": [0xf3], "ei": [0xfb], "ret": [0xc9], "ldir": [0xed, 0xb0], "rra": [0x1f],
+          "cpl": [0x2f], "scf": [0x37], "exx": [0xd9], "nop": [0x00]}
+
+def assemble(source, org, symbols):
+    symbols = dict(symbols)
+    for final in (False, True):
+        pc, code = org, bytearray()
+        for raw in source.splitlines():
+            line = raw.split(";")[0].strip()
+            m = re.match(r"(\w+):\s*(.*)", line)
+            if m:
+                if not final:
+                    symbols[m.group(1)] = pc
+                line = m.group(2)
+            if not line:
+                continue
+            parts = line.split(None, 1)
+            ops = [o.strip() for o in parts[1].split(",")] if len(parts) > 1 else []
+            try:
+                data = encode(parts[0].lower(), ops, pc, symbols, final)
+            except (KeyError, ValueError, NameError, SyntaxError) as e:
+                raise ValueError(f"asm: {raw.strip()}: {e}")
+            code += bytes(data)
+            pc += len(data)
+    return bytes(code), symbols
+
+def encode(mn, ops, pc, symbols, final):
+    def value(expr):
+        try:
+            return eval(expr, {"__builtins__": {}}, symbols)
+        except NameError:
+            if final:
+                raise
+            return 0                  # Метка впереди: адрес будет на втором проходе
+    def word(expr):
+        v = value(expr) & 0xffff
+        return [v & 0xff, v >> 8]
+    def rel(expr):
+        d = value(expr) - (pc + 2)
+        if final and not -128 <= d <= 127:
+            raise ValueError("relative jump out of range")
+        return d & 0xff
+    def mem(op):
+        return op.startswith("(") and op.endswith(")")
+
+    if mn in SIMPLE and not ops:
+        return SIMPLE[mn]
+    if mn == "ld":
+        dst, src = ops
+        if dst in REGS and src in REGS:
+            return [0x40 | REGS[dst] << 3 | REGS[src]]
+        if dst in REGS and src.startswith("(ix"):
+            return [0xdd, 0x46 | REGS[dst] << 3, value(src[3:-1] or "0") & 0xff]
+        if dst.startswith("(ix") and src in REGS:
+            return [0xdd, 0x70 | REGS[src], value(dst[3:-1] or "0") & 0xff]
+        if dst in REGS:
+            return [0x06 | REGS[dst] << 3, value(src) & 0xff]
+        if dst in PAIRS:
+            return [0x01 | PAIRS[dst] << 4] + word(src)
+        if dst == "ix":
+            return [0xdd, 0x21] + word(src)
+    if mn in ("inc", "dec"):
+        op, = ops
+        if op in REGS:
+            return [(0x04 if mn == "inc" else 0x05) | REGS[op] << 3]
+        if op in PAIRS:
+            return [(0x03 if mn == "inc" else 0x0b) | PAIRS[op] << 4]
+        if op == "ix":
+            return [0xdd, 0x23 if mn == "inc" else 0x2b]
+    if mn == "add" and ops[0] == "hl":
+        return [0x09 | PAIRS[ops[1]] << 4]
+    if mn in ALU:
+        op = ops[-1]
+        if op in REGS:
+            return [0x80 | ALU[mn] << 3 | REGS[op]]
+        return [0xc6 | ALU[mn] << 3, value(op) & 0xff]
+    if mn in ("push", "pop"):
+        return [(0xc5 if mn == "push" else 0xc1) | STACK_PAIRS[ops[0]] << 4]
+    if mn == "ret":
+        return [0xc0 | CONDS[ops[0]] << 3]
+    if mn in ("jp", "call"):
+        base = 0xc3 if mn == "jp" else 0xcd
+        if len(ops) == 1:
+            return [base] + word(ops[0])
+        return [(0xc2 if mn == "jp" else 0xc4) | CONDS[ops[0]] << 3] + word(ops[1])
+    if mn == "jr":
+        if len(ops) == 1:
+            return [0x18, rel(ops[0])]
+        if CONDS[ops[0]] > 3:
+            raise ValueError("jr has no such condition")
+        return [0x20 | CONDS[ops[0]] << 3, rel(ops[1])]
+    if mn == "djnz":
+        return [0x10, rel(ops[0])]
+    if mn == "rst":
+        return [0xc7 | value(ops[0])]
+    if mn == "rl":
+        return [0xcb, 0x10 | REGS[ops[0]]]
+    if mn == "out" and ops[0] == "(c)":
+        return [0xed, 0x41 | REGS[ops[1]] << 3]
+    if mn == "out" and mem(ops[0]):
+        return [0xd3, value(ops[0][1:-1]) & 0xff]
+    if mn == "in" and mem(ops[1]):
+        return [0xdb, value(ops[1][1:-1]) & 0xff]
+    raise ValueError("unsupported instruction")
+
+# === ЗАГРУЗЧИК (0x5B00) ===
+# Заставка и код грузятся в верх памяти и распаковываются lz_unpack() из
+# unpack.c; сбой загрузки сбрасывает машину. На 128K буфер принтера занят
+# процедурами 128 BASIC, но в BASIC загрузчик уже не возвращается.
+STAGE_ASM = """
+        di
+        ld sp, STACK_TOP
+        ld bc, 0x7ffd
+        ld a, 0x10
+        out (c), a              ; 128K: ПЗУ 48K и банк 0 (на 48K порт не декодируется)
+        ld hl, 0x5800
+        ld de, 0x5801
+        ld bc, 0x02ff
+        ld (hl), l
+        ldir                    ; Чёрные атрибуты, пока грузится заставка
+        ld ix, SPLASH_AT
+        ld de, SPLASH_LEN
+        call load
+        ld hl, SPLASH_AT
+        ld de, SCREEN_START
+        call unpack
+        ld ix, CODE_AT
+        ld de, CODE_LEN
+        call load
+        ld hl, CODE_AT
+        ld de, ORG
+        call unpack
+        ld h, d                 ; DE — конец распакованного кода
+        ld l, e
+        ld (hl), 0
+        inc de
+        ld bc, FILL_LEN
+        ld a, b
+        or c
+        jr z, run
+        ldir                    ; Нули до конца образа
+run:    xor a
+        out (0xfe), a
+        jp ENTRY
+
+load:   ld a, 0xff
+        scf
+        call LOAD_BYTES
+        di
+        ret c
+        rst 0
+
+unpack: ld b, 0
+u_next: ld a, (hl)
+        inc hl
+        cp 0xff
+        ret z
+        or a
+        jp m, u_match
+        inc a
+        ld c, a
+        ldir
+        jr u_next
+u_match:
+        and 0x7f
+        add a, 3
+        ld c, a
+        ld a, (hl)
+        inc hl
+        push hl
+        ld l, a
+        ld h, 0xff
+        add hl, de
+        ldir
+        pop hl
+        jr u_next
+"""
+
+# === ТУРБО-ЗАГРУЗКА (0x8000) ===
+# Тот же интерфейс и формат блока, что у LD-BYTES (IX, DE, флаг, XOR-сумма;
+# перенос — успех), та же схема измерения: B считает проходы цикла опроса
+# (54 такта) между перепадами. Пилот — 256 пар импульсов нужной длины,
+# синхроимпульс — первый короткий после него.
+TURBO_ASM = """
+turbo:  di
+        ld a, 0x0f
+        out (0xfe), a
+        in a, (0xfe)
+        rra
+        and 0x20
+        or 0x02
+        ld c, a
+start:  ld b, 0
+        call edge1
+        jr nc, start
+        ld h, 0
+leader: ld b, PILOT_B
+        call edge2
+        jr nc, start
+        ld a, PILOT_MIN
+        cp b
+        jr nc, start            ; Пара короче пилота
+        inc h
+        jr nz, leader
+sync:   ld b, SYNC_B
+        call edge1
+        jr nc, start
+        ld a, b
+        cp SYNC_MAX
+        jr nc, sync             ; Ещё пилот
+        call edge1
+        ret nc
+        ld a, c
+        xor 0x03
+        ld c, a
+        ld b, BYTE_B
+        call byte
+        ret nc
+        ld a, l
+        cp 0xff
+        jr nz, fail             ; Чужой флаг
+        ld h, l
+next:   ld b, BYTE_B
+        call byte
+        ret nc
+        ld (ix+0), l
+        inc ix
+        ld a, h
+        xor l
+        ld h, a
+        dec de
+        ld a, d
+        or e
+        jr nz, next
+        ld b, BYTE_B
+        call byte
+        ret nc
+        ld a, h
+        xor l
+        cp 1                    ; Перенос, если сумма сошлась
+        ret
+fail:   xor a
+        ret
+
+byte:   ld l, 1                 ; Маркер: после 8 бит уходит в перенос
+bits:   call edge2
+        ret nc
+        ld a, BIT_THRESHOLD
+        cp b                    ; Длинная пара — единица
+        rl l
+        ld b, BIT_B
+        jp nc, bits
+        ret
+
+edge2:  call edge1
+        ret nc
+edge1:  ld a, EDGE_DELAY
+delay:  dec a
+        jr nz, delay
+        and a
+sample: inc b
+        ret z                   ; Нет перепада: B переполнился
+        ld a, 0x7f
+        in a, (0xfe)
+        rra
+        xor c
+        and 0x20
+        jr z, sample
+        ld a, c                 ; Перепад: полоса бордюра другим цветом
+        cpl
+        ld c, a
+        and 0x07
+        or 0x08
+        out (0xfe), a
+        scf
+        ret
+"""
+
+TURBO_SYMBOLS = {
+    "EDGE_DELAY": 1,
+    "PILOT_B": 0xa0, "PILOT_MIN": 0xc0,     # Пара пилота — 48 отсчётов, единицы — 22
+    "SYNC_B": 0xd8, "SYNC_MAX": 0xe8,       # Синхро ~5 отсчётов, полупериод пилота 24
+    "BYTE_B": 0xd2, "BIT_B": 0xd0,          # Ноль 9, единица 22 отсчёта на пару;
+    "BIT_THRESHOLD": 0xdf,                  # первый бит байта — на 2 отсчёта меньше
+}
+
+# === ФОРМАТЫ ЛЕНТЫ ===
+def tape_block(flag, data):
+    block = bytes([flag]) + bytes(data)
+    check = 0
+    for b in block:
+        check ^= b
+    return block + bytes([check])
+
+def program_header(name, program, autostart):
+    header = bytes([0]) + name.ljust(10)[:10].encode("ascii")
+    header += bytes([len(program) & 0xff, len(program) >> 8, autostart & 0xff, autostart >> 8,
+                     len(program) & 0xff, len(program) >> 8])
+    return tape_block(0x00, header)
+
+def pulses_tstates(block, pilot, pilot_count, sync1, sync2, zero, one):
+    ones = sum(bin(b).count("1") for b in block)
+    return pilot * pilot_count + sync1 + sync2 + 2 * (one * ones + zero * (8 * len(block) - ones))
+
+def rom_seconds(block):
+    pilot_count = ROM_PILOT_HEADER if block[0] < 0x80 else ROM_PILOT_DATA
+    t = pulses_tstates(block, ROM_PILOT, pilot_count, ROM_SYNC1, ROM_SYNC2, ROM_ZERO, ROM_ONE)
+    return t / CPU_HZ + ROM_PAUSE_MS / 1000
+
+def turbo_seconds(block):
+    t = pulses_tstates(block, TURBO_PILOT, TURBO_PILOT_COUNT, TURBO_SYNC1, TURBO_SYNC2, TURBO_ZERO, TURBO_ONE)
+    return t / CPU_HZ + TURBO_PAUSE_MS / 1000
+
+def write_tap(path, blocks):
+    with open(path, "wb") as f:
+        for _, block in blocks:
+            f.write(bytes([len(block) & 0xff, len(block) >> 8]) + block)
+
+def write_tzx(path, blocks):
+    with open(path, "wb") as f:
+        f.write(b"ZXTape!\x1a\x01\x14")
+        for turbo, block in blocks:
+            if not turbo:
+                f.write(bytes([0x10, ROM_PAUSE_MS & 0xff, ROM_PAUSE_MS >> 8, len(block) & 0xff, len(block) >> 8]))
+            else:
+                f.write(bytes([0x11]))
+                for v in (TURBO_PILOT, TURBO_SYNC1, TURBO_SYNC2, TURBO_ZERO, TURBO_ONE, TURBO_PILOT_COUNT):
+                    f.write(bytes([v & 0xff, v >> 8]))
+                f.write(bytes([8, TURBO_PAUSE_MS & 0xff, TURBO_PAUSE_MS >> 8,
+                               len(block) & 0xff, (len(block) >> 8) & 0xff, len(block) >> 16]))
+            f.write(block)
+
+# === РАЗМЕЩЕНИЕ ===
+def inplace_start(packed, dst, size, low):
+    """Адрес сжатого блока в верху памяти, при котором распаковка на месте
+    (вперёд, к тому же концу памяти) не затирает ещё не прочитанные байты."""
+    start = MEMORY_TOP - len(packed)
+    pos, out, need = 0, 0, 0
+    while packed[pos] != 0xff:
+        token = packed[pos]
+        pos += 2 if token & 0x80 else token + 2
+        out += (token & 0x7f) + 3 if token & 0x80 else token + 1
+        need = max(need, out - pos)
+    need = max(need, out - pos)                 # Маркер конца тоже читается последним
+    if start < dst + need or start < low or dst + size > MEMORY_TOP:
+        raise ValueError(f"packed block of {len(packed)} bytes does not fit above 0x{max(dst + need, low):04x}")
+    return start
+
+def main():
+    parser = argparse.ArgumentParser(description="Build a fast-loading .tap/.tzx from the ROM image")
+    parser.add_argument("rom", help="memory image (bin/main.c.rom)")
+    parser.add_argument("splash", help="6912-byte screen shown while the code loads")
+    parser.add_argument("--tap", help="output .tap (ROM speed)")
+    parser.add_argument("--tzx", help="output .tzx (turbo data blocks)")
+    parser.add_argument("--org", type=lambda v: int(v, 0), default=0x5ccb, help="load address of the image")
+    parser.add_argument("--entry", type=lambda v: int(v, 0), help="entry point (default: org)")
+    parser.add_argument("--name", default="8.8.8.8")
+    args = parser.parse_args()
+
+    try:
+        with open(args.rom, "rb") as f:
+            image = f.read()
+        with open(args.splash, "rb") as f:
+            splash = f.read()
+        if len(splash) != SCREEN_SIZE:
+            raise ValueError(f"{args.splash}: {len(splash)} bytes, expected {SCREEN_SIZE}")
+        code = image.rstrip(b"\x00")
+        fill = len(image) - len(code)
+
+        splash_lz, code_lz = pack_lz(splash), pack_lz(code)
+        if unpack_lz(splash_lz) != splash or unpack_lz(code_lz) != code:
+            raise ValueError("LZ round trip failed")
+
+        turbo, _ = assemble(TURBO_ASM, TURBO_START, TURBO_SYMBOLS)
+        symbols = {
+            "STACK_TOP": STACK_TOP, "SCREEN_START": SCREEN_START, "ORG": args.org,
+            "ENTRY": args.entry if args.entry is not None else args.org,
+            "FILL_LEN": max(fill, 1) - 1,
+            "SPLASH_AT": inplace_start(splash_lz, SCREEN_START, SCREEN_SIZE, TURBO_START + len(turbo)),
+            "SPLASH_LEN": len(splash_lz),
+            "CODE_AT": inplace_start(code_lz, args.org, len(code), TURBO_START + len(turbo)),
+            "CODE_LEN": len(code_lz),
+        }
+        stage_rom, _ = assemble(STAGE_ASM, STAGE_START, dict(symbols, LOAD_BYTES=ROM_LD_BYTES))
+        stage_turbo, _ = assemble(STAGE_ASM, STAGE_START, dict(symbols, LOAD_BYTES=TURBO_START))
+        if STAGE_START + len(stage_rom) > STACK_TOP - 32:
+            raise ValueError(f"loader is {len(stage_rom)} bytes, printer buffer leaves no stack")
+
+        def stub(stage):
+            reloc_src = f"""
+                ld hl, REM_CODE + reloc_len
+                ld de, {STAGE_START}
+                ld bc, {len(stage)}
+                ldir
+                ld de, {TURBO_START}
+                ld bc, {len(turbo)}
+                ldir
+                jp {STAGE_START}
+            """
+            reloc, _ = assemble(reloc_src, REM_CODE, {"REM_CODE": REM_CODE, "reloc_len": 0})
+            reloc, _ = assemble(reloc_src, REM_CODE, {"REM_CODE": REM_CODE, "reloc_len": len(reloc)})
+            return basic_stub(reloc + stage + turbo)
+
+        for path, stage, fast in ((args.tap, stage_rom, False), (args.tzx, stage_turbo, True)):
+            if not path:
+                continue
+            program = stub(stage)
+            blocks = [(False, program_header(args.name, program, 10)), (False, tape_block(0xff, program)),
+                      (fast, tape_block(0xff, splash_lz)), (fast, tape_block(0xff, code_lz))]
+            (write_tzx if fast else write_tap)(path, blocks)
+            print(f"✅ Generated {path}")
+            names = ("header", "loader", "splash", "code")
+            total = 0
+            for name, (turbo_block, block) in zip(names, blocks):
+                seconds = turbo_seconds(block) if turbo_block else rom_seconds(block)
+                total += seconds
+                print(f"   {name:7} {len(block):6} bytes  {'turbo' if turbo_block else 'ROM  '}  {seconds:5.1f} s")
+            print(f"   total  {sum(len(b) for _, b in blocks):7} bytes         {total:5.1f} s")
+        print(f"   image {len(image)} bytes from 0x{args.org:04x}: {len(code)} -> {len(code_lz)} packed, "
+              f"{fill} zero-filled; splash {SCREEN_SIZE} -> {len(splash_lz)}")
+    except (OSError, ValueError) as e:
+        print(f"❌ {e}", file=sys.stderr)
+        return 1
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
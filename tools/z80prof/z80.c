@@ -0,0 +1,720 @@
+#include "z80.h"
+#include <stddef.h>
+
+// === ФЛАГИ ===
+#define FLAG_C  0x01
+#define FLAG_N  0x02
+#define FLAG_PV 0x04
+#define FLAG_H  0x10
+#define FLAG_Z  0x40
+#define FLAG_S  0x80
+
+#define HL(z) ((uint16_t)((z)->h << 8 | (z)->l))
+#define BC(z) ((uint16_t)((z)->b << 8 | (z)->c))
+#define DE(z) ((uint16_t)((z)->d << 8 | (z)->e))
+
+static uint8_t parity_table[256];
+
+static uint8_t rd(z80 *z, uint16_t addr) { return z->read(z, addr); }
+static void wr(z80 *z, uint16_t addr, uint8_t val) { z->write(z, addr, val); }
+
+static uint16_t rd16(z80 *z, uint16_t addr) {
+  uint8_t lo = rd(z, addr);
+  return lo | (rd(z, (uint16_t)(addr + 1)) << 8);
+}
+
+static void wr16(z80 *z, uint16_t addr, uint16_t val) {
+  wr(z, addr, val & 0xff);
+  wr(z, (uint16_t)(addr + 1), val >> 8);
+}
+
+static uint8_t fetch(z80 *z) { return rd(z, z->pc++); }
+
+static uint16_t fetch16(z80 *z) {
+  uint16_t val = rd16(z, z->pc);
+  z->pc += 2;
+  return val;
+}
+
+// Цикл M1: чтение кода операции с приращением регистра R
+static uint8_t fetch_op(z80 *z) {
+  z->r = (z->r & 0x80) | ((z->r + 1) & 0x7f);
+  return fetch(z);
+}
+
+static void push(z80 *z, uint16_t val) {
+  z->sp -= 2;
+  wr16(z, z->sp, val);
+}
+
+static uint16_t pop(z80 *z) {
+  uint16_t val = rd16(z, z->sp);
+  z->sp += 2;
+  return val;
+}
+
+static uint8_t szp(uint8_t v) {
+  return (v & FLAG_S) | (v ? 0 : FLAG_Z) | parity_table[v];
+}
+
+// === АРИФМЕТИКА ===
+static void alu(z80 *z, int op, uint8_t v) {
+  int a = z->a, res;
+  int carry = z->f & FLAG_C;
+  switch (op) {
+    case 0: carry = 0;  // ADD
+    case 1:             // ADC
+      res = a + v + carry;
+      z->f = (res & FLAG_S) | ((res & 0xff) ? 0 : FLAG_Z) | ((a ^ v ^ res) & FLAG_H)
+           | ((~(a ^ v) & (a ^ res) & 0x80) ? FLAG_PV : 0) | (res > 0xff ? FLAG_C : 0);
+      z->a = res;
+      break;
+    case 2: carry = 0;  // SUB
+    case 3:             // SBC
+    case 7:             // CP
+      if (op == 7) carry = 0;
+      res = a - v - carry;
+      z->f = (res & FLAG_S) | ((res & 0xff) ? 0 : FLAG_Z) | ((a ^ v ^ res) & FLAG_H)
+           | (((a ^ v) & (a ^ res) & 0x80) ? FLAG_PV : 0) | (res < 0 ? FLAG_C : 0) | FLAG_N;
+      if (op != 7) z->a = res;
+      break;
+    case 4: z->a &= v; z->f = szp(z->a) | FLAG_H; break;  // AND
+    case 5: z->a ^= v; z->f = szp(z->a); break;           // XOR
+    case 6: z->a |= v; z->f = szp(z->a); break;           // OR
+  }
+}
+
+static uint8_t inc8(z80 *z, uint8_t v) {
+  uint8_t res = v + 1;
+  z->f = (z->f & FLAG_C) | (res & FLAG_S) | (res ? 0 : FLAG_Z)
+       | ((v & 0x0f) == 0x0f ? FLAG_H : 0) | (v == 0x7f ? FLAG_PV : 0);
+  return res;
+}
+
+static uint8_t dec8(z80 *z, uint8_t v) {
+  uint8_t res = v - 1;
+  z->f = (z->f & FLAG_C) | (res & FLAG_S) | (res ? 0 : FLAG_Z) | FLAG_N
+       | ((v & 0x0f) == 0 ? FLAG_H : 0) | (v == 0x80 ? FLAG_PV : 0);
+  return res;
+}
+
+static uint16_t add16(z80 *z, uint16_t a, uint16_t v) {
+  uint32_t res = a + v;
+  z->f = (z->f & (FLAG_S | FLAG_Z | FLAG_PV)) | (((a ^ v ^ res) >> 8) & FLAG_H)
+       | (res > 0xffff ? FLAG_C : 0);
+  return res;
+}
+
+static uint16_t adc16(z80 *z, uint16_t a, uint16_t v) {
+  uint32_t res = a + v + (z->f & FLAG_C);
+  z->f = ((res >> 8) & FLAG_S) | ((res & 0xffff) ? 0 : FLAG_Z) | (((a ^ v ^ res) >> 8) & FLAG_H)
+       | ((~(a ^ v) & (a ^ res) & 0x8000) ? FLAG_PV : 0) | (res > 0xffff ? FLAG_C : 0);
+  return res;
+}
+
+static uint16_t sbc16(z80 *z, uint16_t a, uint16_t v) {
+  int32_t res = (int32_t)a - v - (z->f & FLAG_C);
+  z->f = ((res >> 8) & FLAG_S) | ((res & 0xffff) ? 0 : FLAG_Z) | (((a ^ v ^ res) >> 8) & FLAG_H)
+       | (((a ^ v) & (a ^ res) & 0x8000) ? FLAG_PV : 0) | (res < 0 ? FLAG_C : 0) | FLAG_N;
+  return res;
+}
+
+// Сдвиги и вращения группы CB (RLC, RRC, RL, RR, SLA, SRA, SLL, SRL)
+static uint8_t rot(z80 *z, int op, uint8_t v) {
+  uint8_t carry, res;
+  switch (op) {
+    case 0: carry = v >> 7; res = (v << 1) | carry; break;
+    case 1: carry = v & 1; res = (v >> 1) | (carry << 7); break;
+    case 2: carry = v >> 7; res = (v << 1) | (z->f & FLAG_C); break;
+    case 3: carry = v & 1; res = (v >> 1) | ((z->f & FLAG_C) << 7); break;
+    case 4: carry = v >> 7; res = v << 1; break;
+    case 5: carry = v & 1; res = (v >> 1) | (v & 0x80); break;
+    case 6: carry = v >> 7; res = (v << 1) | 1; break;
+    default: carry = v & 1; res = v >> 1; break;
+  }
+  z->f = szp(res) | carry;
+  return res;
+}
+
+static void daa(z80 *z) {
+  uint8_t a = z->a, corr = 0, carry = z->f & FLAG_C;
+  if ((z->f & FLAG_H) || (a & 0x0f) > 9) corr |= 0x06;
+  if (carry || a > 0x99) {
+    corr |= 0x60;
+    carry = FLAG_C;
+  }
+  if (z->f & FLAG_N) {
+    z->f = (z->f & FLAG_N) | (((a & 0x0f) < 6 && (z->f & FLAG_H)) ? FLAG_H : 0);
+    a -= corr;
+  } else {
+    z->f = ((a & 0x0f) > 9) ? FLAG_H : 0;
+    a += corr;
+  }
+  z->a = a;
+  z->f = (z->f & (FLAG_H | FLAG_N)) | szp(a) | carry;
+}
+
+static int condition(z80 *z, int cc) {
+  switch (cc) {
+    case 0: return !(z->f & FLAG_Z);
+    case 1: return z->f & FLAG_Z;
+    case 2: return !(z->f & FLAG_C);
+    case 3: return z->f & FLAG_C;
+    case 4: return !(z->f & FLAG_PV);
+    case 5: return z->f & FLAG_PV;
+    case 6: return !(z->f & FLAG_S);
+    default: return z->f & FLAG_S;
+  }
+}
+
+// === ДОСТУП К РЕГИСТРАМ ПО НОМЕРУ (B C D E H L (HL) A) ===
+// idx: NULL — обычный режим, иначе указатель на IX/IY (H/L → IXH/IXL)
+static uint8_t get_r(z80 *z, int r, uint16_t *idx) {
+  switch (r) {
+    case 0: return z->b;
+    case 1: return z->c;
+    case 2: return z->d;
+    case 3: return z->e;
+    case 4: return idx ? *idx >> 8 : z->h;
+    case 5: return idx ? *idx & 0xff : z->l;
+    case 7: return z->a;
+  }
+  return 0;
+}
+
+static void set_r(z80 *z, int r, uint16_t *idx, uint8_t v) {
+  switch (r) {
+    case 0: z->b = v; break;
+    case 1: z->c = v; break;
+    case 2: z->d = v; break;
+    case 3: z->e = v; break;
+    case 4: if (idx) *idx = (*idx & 0x00ff) | (v << 8); else z->h = v; break;
+    case 5: if (idx) *idx = (*idx & 0xff00) | v; else z->l = v; break;
+    case 7: z->a = v; break;
+  }
+}
+
+static uint16_t get_rp(z80 *z, int p, uint16_t *idx) {
+  switch (p) {
+    case 0: return BC(z);
+    case 1: return DE(z);
+    case 2: return idx ? *idx : HL(z);
+  }
+  return z->sp;
+}
+
+static void set_rp(z80 *z, int p, uint16_t *idx, uint16_t v) {
+  switch (p) {
+    case 0: z->b = v >> 8; z->c = v; break;
+    case 1: z->d = v >> 8; z->e = v; break;
+    case 2: if (idx) *idx = v; else { z->h = v >> 8; z->l = v; } break;
+    default: z->sp = v; break;
+  }
+}
+
+// Для PUSH/POP: BC DE HL AF
+static uint16_t get_rp2(z80 *z, int p, uint16_t *idx) {
+  return p == 3 ? (uint16_t)(z->a << 8 | z->f) : get_rp(z, p, idx);
+}
+
+static void set_rp2(z80 *z, int p, uint16_t *idx, uint16_t v) {
+  if (p == 3) {
+    z->a = v >> 8;
+    z->f = v;
+  } else {
+    set_rp(z, p, idx, v);
+  }
+}
+
+// Адрес операнда (HL) или (IX+d); смещение читается из потока команд
+static uint16_t mem_operand(z80 *z, uint16_t *idx) {
+  if (!idx) return HL(z);
+  return *idx + (int8_t)fetch(z);
+}
+
+// === ПРЕФИКС CB / DDCB / FDCB ===
+static int exec_cb(z80 *z, uint16_t *idx) {
+  uint16_t addr = 0;
+  uint8_t op, v, res;
+  int x, y, r;
+
+  if (idx) {
+    addr = *idx + (int8_t)fetch(z);
+    op = fetch(z);                 // Код операции DDCB не является циклом M1
+  } else {
+    op = fetch_op(z);
+  }
+  x = op >> 6;
+  y = (op >> 3) & 7;
+  r = op & 7;
+
+  if (idx || r == 6) {
+    if (!idx) addr = HL(z);
+    v = rd(z, addr);
+  } else {
+    v = get_r(z, r, NULL);
+  }
+
+  switch (x) {
+    case 0: res = rot(z, y, v); break;
+    case 1:
+      z->f = (z->f & FLAG_C) | FLAG_H | ((v & (1 << y)) ? 0 : (FLAG_Z | FLAG_PV))
+           | ((y == 7 && (v & 0x80)) ? FLAG_S : 0);
+      if (idx) return 16;             // 20 тактов вместе с префиксом DD/FD
+      return r == 6 ? 12 : 8;
+    case 2: res = v & ~(1 << y); break;
+    default: res = v | (1 << y); break;
+  }
+
+  if (idx) {
+    wr(z, addr, res);
+    if (r != 6) set_r(z, r, NULL, res);  // Недокументированное копирование в регистр
+    return 19;                           // 23 такта вместе с префиксом
+
+  }
+  if (r == 6) {
+    wr(z, addr, res);
+    return 15;
+  }
+  set_r(z, r, NULL, res);
+  return 8;
+}
+
+// === ПРЕФИКС ED ===
+static int exec_ed(z80 *z) {
+  uint8_t op = fetch_op(z);
+  int x = op >> 6, y = (op >> 3) & 7, r = op & 7, p = y >> 1, q = y & 1;
+  uint8_t v;
+  uint16_t hl;
+
+  if (x == 1) {
+    switch (r) {
+      case 0:  // IN r,(C)
+        v = z->in(z, BC(z));
+        z->f = (z->f & FLAG_C) | szp(v);
+        if (y != 6) set_r(z, y, NULL, v);
+        return 12;
+      case 1:  // OUT (C),r
+        z->out(z, BC(z), y == 6 ? 0 : get_r(z, y, NULL));
+        return 12;
+      case 2:  // SBC/ADC HL,rr
+        hl = q ? adc16(z, HL(z), get_rp(z, p, NULL)) : sbc16(z, HL(z), get_rp(z, p, NULL));
+        z->h = hl >> 8;
+        z->l = hl;
+        return 15;
+      case 3:  // LD (nn),rr / LD rr,(nn)
+        hl = fetch16(z);
+        if (q) set_rp(z, p, NULL, rd16(z, hl));
+        else wr16(z, hl, get_rp(z, p, NULL));
+        return 20;
+      case 4:  // NEG
+        v = z->a;
+        z->a = 0;
+        alu(z, 2, v);
+        return 8;
+      case 5:  // RETN / RETI
+        z->pc = pop(z);
+        z->iff1 = z->iff2;
+        return 14;
+      case 6:  // IM
+        z->im = (y & 3) < 2 ? 0 : (y & 3) - 1;
+        return 8;
+      default:
+        switch (y) {
+          case 0: z->i = z->a; return 9;
+          case 1: z->r = z->a; return 9;
+          case 2:
+          case 3:
+            z->a = y == 2 ? z->i : z->r;
+            z->f = (z->f & FLAG_C) | (z->a & FLAG_S) | (z->a ? 0 : FLAG_Z) | (z->iff2 ? FLAG_PV : 0);
+            return 9;
+          case 4: {  // RRD
+            uint8_t m = rd(z, HL(z));
+            wr(z, HL(z), (z->a << 4) | (m >> 4));
+            z->a = (z->a & 0xf0) | (m & 0x0f);
+            z->f = (z->f & FLAG_C) | szp(z->a);
+            return 18;
+          }
+          case 5: {  // RLD
+            uint8_t m = rd(z, HL(z));
+            wr(z, HL(z), (m << 4) | (z->a & 0x0f));
+            z->a = (z->a & 0xf0) | (m >> 4);
+            z->f = (z->f & FLAG_C) | szp(z->a);
+            return 18;
+          }
+        }
+        return 8;
+    }
+  }
+
+  if (x == 2 && y >= 4 && r <= 3) {
+    // Блочные команды: LDI/LDD/LDIR/LDDR, CPI..., INI..., OUTI...
+    int step = (y & 1) ? -1 : 1;
+    int repeat = y >= 6;
+    uint16_t bc;
+    hl = HL(z);
+    switch (r) {
+      case 0:  // LD
+        wr(z, DE(z), rd(z, hl));
+        hl += step;
+        { uint16_t de = DE(z) + step; z->d = de >> 8; z->e = de; }
+        bc = BC(z) - 1;
+        z->b = bc >> 8;
+        z->c = bc;
+        z->f = (z->f & (FLAG_S | FLAG_Z | FLAG_C)) | (bc ? FLAG_PV : 0);
+        break;
+      case 1: {  // CP
+        uint8_t m = rd(z, hl);
+        uint8_t res = z->a - m;
+        hl += step;
+        bc = BC(z) - 1;
+        z->b = bc >> 8;
+        z->c = bc;
+        z->f = (z->f & FLAG_C) | FLAG_N | (res & FLAG_S) | (res ? 0 : FLAG_Z)
+             | ((z->a ^ m ^ res) & FLAG_H) | (bc ? FLAG_PV : 0);
+        if (repeat && !res) repeat = 0;
+        break;
+      }
+      case 2:  // IN
+        wr(z, hl, z->in(z, BC(z)));
+        hl += step;
+        z->b--;
+        z->f = FLAG_N | (z->b ? 0 : FLAG_Z);
+        bc = z->b;
+        break;
+      default:  // OUT
+        z->b--;
+        z->out(z, BC(z), rd(z, hl));
+        hl += step;
+        z->f = FLAG_N | (z->b ? 0 : FLAG_Z);
+        bc = z->b;
+        break;
+    }
+    z->h = hl >> 8;
+    z->l = hl;
+    if (repeat && bc) {
+      z->pc -= 2;
+      return 21;
+    }
+    return 16;
+  }
+
+  return 8;  // Недокументированные ED-команды работают как NOP
+}
+
+// === ОСНОВНОЙ ДЕКОДЕР ===
+int z80_step(z80 *z) {
+  uint16_t *idx = NULL;
+  uint8_t op, v;
+  uint16_t addr, tmp;
+  int t = 0;
+  int x, y, r, p, q;
+
+  z->ei_pending = 0;
+
+  if (z->halted) {
+    z->r = (z->r & 0x80) | ((z->r + 1) & 0x7f);
+    z->cycles += 4;
+    return 4;
+  }
+
+  op = fetch_op(z);
+  while (op == 0xdd || op == 0xfd) {
+    idx = op == 0xdd ? &z->ix : &z->iy;
+    t += 4;
+    op = fetch_op(z);
+  }
+
+  if (op == 0xcb) {
+    t += exec_cb(z, idx);
+    z->cycles += t;
+    return t;
+  }
+  if (op == 0xed) {
+    t += exec_ed(z);
+    z->cycles += t;
+    return t;
+  }
+
+  x = op >> 6;
+  y = (op >> 3) & 7;
+  r = op & 7;
+  p = y >> 1;
+  q = y & 1;
+
+  switch (x) {
+    case 0:
+      switch (r) {
+        case 0:
+          switch (y) {
+            case 0: t += 4; break;  // NOP
+            case 1: {               // EX AF,AF'
+              uint8_t ta = z->a, tf = z->f;
+              z->a = z->a_; z->f = z->f_;
+              z->a_ = ta; z->f_ = tf;
+              t += 4;
+              break;
+            }
+            case 2:                 // DJNZ
+              v = fetch(z);
+              if (--z->b) {
+                z->pc += (int8_t)v;
+                t += 13;
+              } else {
+                t += 8;
+              }
+              break;
+            case 3:                 // JR
+              v = fetch(z);
+              z->pc += (int8_t)v;
+              t += 12;
+              break;
+            default:                // JR cc
+              v = fetch(z);
+              if (condition(z, y - 4)) {
+                z->pc += (int8_t)v;
+                t += 12;
+              } else {
+                t += 7;
+              }
+              break;
+          }
+          break;
+        case 1:
+          if (q) {  // ADD HL,rr
+            set_rp(z, 2, idx, add16(z, get_rp(z, 2, idx), get_rp(z, p, idx)));
+            t += 11;
+          } else {  // LD rr,nn
+            set_rp(z, p, idx, fetch16(z));
+            t += 10;
+          }
+          break;
+        case 2:
+          switch (y) {
+            case 0: wr(z, BC(z), z->a); t += 7; break;
+            case 1: z->a = rd(z, BC(z)); t += 7; break;
+            case 2: wr(z, DE(z), z->a); t += 7; break;
+            case 3: z->a = rd(z, DE(z)); t += 7; break;
+            case 4: wr16(z, fetch16(z), get_rp(z, 2, idx)); t += 16; break;
+            case 5: set_rp(z, 2, idx, rd16(z, fetch16(z))); t += 16; break;
+            case 6: wr(z, fetch16(z), z->a); t += 13; break;
+            default: z->a = rd(z, fetch16(z)); t += 13; break;
+          }
+          break;
+        case 3:  // INC/DEC rr
+          set_rp(z, p, idx, get_rp(z, p, idx) + (q ? -1 : 1));
+          t += 6;
+          break;
+        case 4:
+        case 5:  // INC/DEC r
+          if (y == 6) {
+            addr = mem_operand(z, idx);
+            v = rd(z, addr);
+            wr(z, addr, r == 4 ? inc8(z, v) : dec8(z, v));
+            t += idx ? 19 : 11;
+          } else {
+            v = get_r(z, y, idx);
+            set_r(z, y, idx, r == 4 ? inc8(z, v) : dec8(z, v));
+            t += 4;
+          }
+          break;
+        case 6:  // LD r,n
+          if (y == 6) {
+            addr = mem_operand(z, idx);
+            wr(z, addr, fetch(z));
+            t += idx ? 15 : 10;
+          } else {
+            set_r(z, y, idx, fetch(z));
+            t += 7;
+          }
+          break;
+        default:
+          switch (y) {
+            case 0:  // RLCA
+              z->a = (z->a << 1) | (z->a >> 7);
+              z->f = (z->f & (FLAG_S | FLAG_Z | FLAG_PV)) | (z->a & FLAG_C);
+              break;
+            case 1:  // RRCA
+              z->f = (z->f & (FLAG_S | FLAG_Z | FLAG_PV)) | (z->a & FLAG_C);
+              z->a = (z->a >> 1) | (z->a << 7);
+              break;
+            case 2:  // RLA
+              v = z->a >> 7;
+              z->a = (z->a << 1) | (z->f & FLAG_C);
+              z->f = (z->f & (FLAG_S | FLAG_Z | FLAG_PV)) | v;
+              break;
+            case 3:  // RRA
+              v = z->a & 1;
+              z->a = (z->a >> 1) | ((z->f & FLAG_C) << 7);
+              z->f = (z->f & (FLAG_S | FLAG_Z | FLAG_PV)) | v;
+              break;
+            case 4: daa(z); break;
+            case 5: z->a = ~z->a; z->f |= FLAG_H | FLAG_N; break;
+            case 6: z->f = (z->f & (FLAG_S | FLAG_Z | FLAG_PV)) | FLAG_C; break;
+            default:
+              z->f = ((z->f & (FLAG_S | FLAG_Z | FLAG_PV | FLAG_C)) | ((z->f & FLAG_C) << 4)) ^ FLAG_C;
+              break;
+          }
+          t += 4;
+          break;
+      }
+      break;
+
+    case 1:
+      if (y == 6 && r == 6) {  // HALT
+        z->halted = 1;
+        t += 4;
+      } else if (y == 6) {     // LD (HL),r — H/L не подменяются на IXH/IXL
+        addr = mem_operand(z, idx);
+        wr(z, addr, get_r(z, r, NULL));
+        t += idx ? 15 : 7;
+      } else if (r == 6) {     // LD r,(HL)
+        addr = mem_operand(z, idx);
+        set_r(z, y, NULL, rd(z, addr));
+        t += idx ? 15 : 7;
+      } else {
+        set_r(z, y, idx, get_r(z, r, idx));
+        t += 4;
+      }
+      break;
+
+    case 2:  // ALU A,r
+      if (r == 6) {
+        addr = mem_operand(z, idx);
+        alu(z, y, rd(z, addr));
+        t += idx ? 15 : 7;
+      } else {
+        alu(z, y, get_r(z, r, idx));
+        t += 4;
+      }
+      break;
+
+    default:
+      switch (r) {
+        case 0:  // RET cc
+          if (condition(z, y)) {
+            z->pc = pop(z);
+            t += 11;
+          } else {
+            t += 5;
+          }
+          break;
+        case 1:
+          if (!q) {  // POP
+            set_rp2(z, p, idx, pop(z));
+            t += 10;
+          } else {
+            switch (p) {
+              case 0: z->pc = pop(z); t += 10; break;  // RET
+              case 1: {                               // EXX
+                uint8_t tb = z->b, tc = z->c, td = z->d, te = z->e, th = z->h, tl = z->l;
+                z->b = z->b_; z->c = z->c_; z->d = z->d_; z->e = z->e_; z->h = z->h_; z->l = z->l_;
+                z->b_ = tb; z->c_ = tc; z->d_ = td; z->e_ = te; z->h_ = th; z->l_ = tl;
+                t += 4;
+                break;
+              }
+              case 2: z->pc = get_rp(z, 2, idx); t += 4; break;  // JP (HL)
+              default: z->sp = get_rp(z, 2, idx); t += 6; break; // LD SP,HL
+            }
+          }
+          break;
+        case 2:  // JP cc,nn
+          addr = fetch16(z);
+          if (condition(z, y)) z->pc = addr;
+          t += 10;
+          break;
+        case 3:
+          switch (y) {
+            case 0: z->pc = fetch16(z); t += 10; break;                 // JP nn
+            case 2: z->out(z, (z->a << 8) | fetch(z), z->a); t += 11; break;  // OUT (n),A
+            case 3: z->a = z->in(z, (z->a << 8) | fetch(z)); t += 11; break;  // IN A,(n)
+            case 4:                                                     // EX (SP),HL
+              tmp = rd16(z, z->sp);
+              wr16(z, z->sp, get_rp(z, 2, idx));
+              set_rp(z, 2, idx, tmp);
+              t += 19;
+              break;
+            case 5:                                                     // EX DE,HL
+              v = z->d; z->d = z->h; z->h = v;
+              v = z->e; z->e = z->l; z->l = v;
+              t += 4;
+              break;
+            case 6: z->iff1 = z->iff2 = 0; t += 4; break;               // DI
+            case 7: z->iff1 = z->iff2 = 1; z->ei_pending = 1; t += 4; break;  // EI
+          }
+          break;
+        case 4:  // CALL cc,nn
+          addr = fetch16(z);
+          if (condition(z, y)) {
+            push(z, z->pc);
+            z->pc = addr;
+            t += 17;
+          } else {
+            t += 10;
+          }
+          break;
+        case 5:
+          if (!q) {  // PUSH
+            push(z, get_rp2(z, p, idx));
+            t += 11;
+          } else {   // CALL nn (p == 0; префиксы обработаны выше)
+            addr = fetch16(z);
+            push(z, z->pc);
+            z->pc = addr;
+            t += 17;
+          }
+          break;
+        case 6:  // ALU A,n
+          alu(z, y, fetch(z));
+          t += 7;
+          break;
+        default:  // RST
+          push(z, z->pc);
+          z->pc = y * 8;
+          t += 11;
+          break;
+      }
+      break;
+  }
+
+  z->cycles += t;
+  return t;
+}
+
+int z80_interrupt(z80 *z, uint8_t data_bus) {
+  int t;
+  if (!z->iff1 || z->ei_pending) return 0;
+  if (z->halted) {
+    z->halted = 0;
+  }
+  z->iff1 = z->iff2 = 0;
+  z->r = (z->r & 0x80) | ((z->r + 1) & 0x7f);
+  push(z, z->pc);
+  if (z->im == 2) {
+    z->pc = rd16(z, (uint16_t)(z->i << 8 | data_bus));
+    t = 19;
+  } else {
+    z->pc = 0x38;  // IM 1 (и IM 0 с RST 38h на шине — стандарт для Spectrum)
+    t = 13;
+  }
+  z->cycles += t;
+  return t;
+}
+
+void z80_reset(z80 *z) {
+  for (int i = 0; i < 256; i++) {
+    int bits = 0;
+    for (int b = 0; b < 8; b++) bits += (i >> b) & 1;
+    parity_table[i] = (bits & 1) ? 0 : FLAG_PV;
+  }
+  z->a = z->f = 0xff;
+  z->b = z->c = z->d = z->e = z->h = z->l = 0;
+  z->a_ = z->f_ = z->b_ = z->c_ = z->d_ = z->e_ = z->h_ = z->l_ = 0;
+  z->ix = z->iy = 0;
+  z->sp = 0xffff;
+  z->pc = 0;
+  z->i = z->r = 0;
+  z->iff1 = z->iff2 = z->im = 0;
+  z->halted = z->ei_pending = 0;
+  z->cycles = 0;
+}
@@ -0,0 +1,36 @@
+#ifndef __Z80_H
+#define __Z80_H
+
+// Компактное ядро Z80 с подсчётом тактов (T-states) для профилировщика.
+// Документированные инструкции плюс недокументированные IXH/IXL, SLL и
+// DDCB/FDCB с копированием результата в регистр. Флаги 3/5 не эмулируются.
+
+#include <stdint.h>
+
+typedef struct z80 z80;
+
+struct z80 {
+  // Основной и альтернативный наборы регистров
+  uint8_t a, f, b, c, d, e, h, l;
+  uint8_t a_, f_, b_, c_, d_, e_, h_, l_;
+  uint16_t ix, iy, sp, pc;
+  uint8_t i, r;
+  uint8_t iff1, iff2, im;
+  uint8_t halted;
+  uint8_t ei_pending;        // EI разрешает прерывания только после следующей команды
+
+  uint64_t cycles;           // Счётчик тактов с момента сброса
+
+  // Доступ к памяти и портам; обработчик может добавить такты задержки в cycles
+  uint8_t (*read)(z80 *z, uint16_t addr);
+  void (*write)(z80 *z, uint16_t addr, uint8_t val);
+  uint8_t (*in)(z80 *z, uint16_t port);
+  void (*out)(z80 *z, uint16_t port, uint8_t val);
+  void *user;
+};
+
+void z80_reset(z80 *z);
+int z80_step(z80 *z);                          // Одна команда; возвращает такты без задержек памяти
+int z80_interrupt(z80 *z, uint8_t data_bus);   // Маскируемое прерывание (IM 0/1/2); 0 — не принято
+
+#endif // __Z80_H
@@ -0,0 +1,502 @@
+// Безголовый профилировщик ROM-сборки: исполняет bin/main.c.rom на ядре Z80
+// (48K, 3.5 МГц, кадр 69888 тактов), подаёт на порт 0xFE нажатия из сценария и
+// считает такты каждого вызова engine_render() с разбивкой по функциям.
+//
+// Использование:
+//   z80prof [-o org] [-s sp] [-m symbols] [-e symbol] [-j out.json] [-d screen.scr] <rom> <script>
+//     -o org      адрес загрузки образа и точка входа (по умолчанию 0x5ccb)
+//     -s sp       начальный указатель стека (по умолчанию 0xff58, RAMTOP 48K)
+//     -m file     таблица символов SDCC (.map/.noi) или "адрес имя" построчно;
+//                 без неё функциями считаются адреса вызовов CALL (sub_XXXX)
+//     -e symbol   функция кадра: имя или адрес (по умолчанию _engine_render);
+//                 без неё кадром считается интервал между чтениями порта 0xFE
+//     -j file     записать сводку в JSON
+//     -d file     сохранить экран (6912 байт, .scr) по завершении
+//
+// Сценарий: строки "КЛАВИШИ N" — состояние джойстика на N чтений порта 0xFE,
+// клавиши через '+': LEFT RIGHT UP DOWN FIRE или NONE. '#' — комментарий.
+// Эмуляция завершается при чтении порта после конца сценария.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "z80.h"
+
+#define CPU_HZ 3500000
+#define FRAME_TSTATES 69888
+#define CONTENDED_START 14335      // Такт первого спорного доступа в кадре
+#define LINE_TSTATES 224
+#define MAX_TSTATES (CPU_HZ * 600ULL)  // Предохранитель от зависания: 10 минут эмуляции
+
+#define MAX_SYMBOLS 4096
+#define MAX_RENDERS 65536
+#define MAX_STEPS 4096
+
+typedef struct {
+  unsigned int addr;
+  char name[128];
+} t_symbol;
+
+typedef struct {
+  unsigned char keys;
+  unsigned int count;
+} t_step;
+
+// === СОСТОЯНИЕ МАШИНЫ ===
+static uint8_t mem[0x10000];
+
+static t_symbol symbols[MAX_SYMBOLS];
+static int num_symbols;
+
+static t_step steps[MAX_STEPS];
+static int num_steps;
+static int cur_step;
+static unsigned int cur_step_reads;
+static int script_done;
+static unsigned long port_reads;
+
+// === СТАТИСТИКА ===
+static int render_addr = -1;           // Адрес функции кадра или -1
+static int in_render;
+static uint64_t render_start;
+static uint64_t render_contended_start;
+static uint16_t render_ret_addr, render_ret_sp;
+static uint64_t renders[MAX_RENDERS];
+static uint64_t render_contended[MAX_RENDERS];
+static int num_renders;
+static uint64_t startup_tstates;       // От входа до первого кадра
+
+static uint64_t pc_tstates[0x10000];   // Такты внутри кадров по адресу команды
+static uint8_t call_targets[0x10000];  // Адреса, на которые был выполнен CALL
+static uint64_t contended_tstates;     // Все задержки спорной памяти
+static uint64_t screen_write_tstates;  // Задержки записи в экран 0x4000–0x5AFF
+static uint64_t screen_writes;
+static uint64_t render_screen_write_tstates;
+static uint64_t render_screen_writes;
+static uint64_t last_port_read;
+static uint64_t access_clock;          // Оценка такта текущего доступа к памяти
+
+// === СПОРНАЯ ПАМЯТЬ 48K ===
+// Доступ к 0x4000–0x7FFF во время вывода строки экрана задерживается по
+// шаблону 6,5,4,3,2,1,0,0. Внутри команды каждый доступ к памяти считается
+// отстоящим от предыдущего на 3 такта (машинный цикл), поэтому модель
+// приближённая: точность в пределах нескольких тактов на команду.
+static int contention_delay(uint64_t t) {
+  static const int pattern[8] = { 6, 5, 4, 3, 2, 1, 0, 0 };
+  long frame_t = (long)(t % FRAME_TSTATES) - CONTENDED_START;
+  if (frame_t < 0 || frame_t >= 192 * LINE_TSTATES) return 0;
+  frame_t %= LINE_TSTATES;
+  if (frame_t >= 128) return 0;
+  return pattern[frame_t & 7];
+}
+
+static int contend(z80 *z, uint16_t addr) {
+  int delay = 0;
+  if (addr >= 0x4000 && addr < 0x8000) {
+    delay = contention_delay(access_clock);
+    z->cycles += delay;
+    contended_tstates += delay;
+  }
+  access_clock += delay + 3;
+  return delay;
+}
+
+static uint8_t mem_read(z80 *z, uint16_t addr) {
+  contend(z, addr);
+  return mem[addr];
+}
+
+static void mem_write(z80 *z, uint16_t addr, uint8_t val) {
+  int delay = contend(z, addr);
+  if (addr < 0x4000) return;  // ПЗУ
+  if (addr < 0x8000) {
+    if (addr < 0x5b00) {
+      screen_write_tstates += delay;
+      screen_writes++;
+      if (in_render || (render_addr < 0 && port_reads)) {
+        render_screen_write_tstates += delay;
+        render_screen_writes++;
+      }
+    }
+  }
+  mem[addr] = val;
+}
+
+static uint8_t port_in(z80 *z, uint16_t port) {
+  unsigned char keys = 0;
+  if ((port & 0xff) != 0xfe) return 0xff;
+
+  // Без функции кадра кадром считается интервал между опросами клавиатуры
+  if (render_addr < 0 && num_renders < MAX_RENDERS && last_port_read) {
+    render_contended[num_renders] = contended_tstates - render_contended_start;
+    renders[num_renders++] = z->cycles - last_port_read;
+  }
+  last_port_read = z->cycles;
+  render_contended_start = contended_tstates;
+  port_reads++;
+
+  while (cur_step < num_steps && cur_step_reads >= steps[cur_step].count) {
+    cur_step++;
+    cur_step_reads = 0;
+  }
+  if (cur_step >= num_steps) {
+    script_done = 1;
+  } else {
+    keys = steps[cur_step].keys;
+    cur_step_reads++;
+  }
+  return 0xff ^ keys;  // Нажатие = 0
+}
+
+static void port_out(z80 *z, uint16_t port, uint8_t val) {
+  (void)z; (void)port; (void)val;
+}
+
+// === СИМВОЛЫ ===
+static int parse_hex(const char *s, unsigned int *val) {
+  char *end;
+  if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) s += 2;
+  if (!isxdigit((unsigned char)*s)) return 0;
+  *val = strtoul(s, &end, 16);
+  return *end == 0;
+}
+
+static int is_ident(const char *s) {
+  if (!isalpha((unsigned char)*s) && *s != '_') return 0;
+  for (; *s; s++) if (!isalnum((unsigned char)*s) && *s != '_' && *s != '.') return 0;
+  return 1;
+}
+
+static int cmp_symbols(const void *a, const void *b) {
+  const t_symbol *sa = a, *sb = b;
+  return (int)sa->addr - (int)sb->addr;
+}
+
+static void add_symbol(unsigned int addr, const char *name) {
+  if (num_symbols == MAX_SYMBOLS) return;
+  symbols[num_symbols].addr = addr;
+  snprintf(symbols[num_symbols].name, sizeof(symbols[num_symbols].name), "%s", name);
+  num_symbols++;
+}
+
+// Без таблицы символов функциями считаются точка входа и цели вызовов CALL
+static void symbols_from_calls(unsigned int entry) {
+  char name[16];
+  for (unsigned int addr = 0; addr < 0x10000; addr++) {
+    if (!call_targets[addr] && addr != entry) continue;
+    snprintf(name, sizeof(name), "sub_%04X", addr);
+    add_symbol(addr, name);
+  }
+}
+
+// Принимает .noi ("DEF имя 0xАДРЕС"), .map sdld ("АДРЕС имя") и "адрес имя"
+static int load_symbols(const char *file_name) {
+  char line[512], tok[3][128];
+  FILE *f = fopen(file_name, "r");
+  if (!f) {
+    perror(file_name);
+    return 0;
+  }
+  while (fgets(line, sizeof(line), f) && num_symbols < MAX_SYMBOLS) {
+    unsigned int addr;
+    const char *name = NULL;
+    int n;
+    if (line[0] == '#' || line[0] == ';') continue;
+    n = sscanf(line, "%127s %127s %127s", tok[0], tok[1], tok[2]);
+    if (n == 3 && !strcmp(tok[0], "DEF") && parse_hex(tok[2], &addr)) name = tok[1];
+    else if (n == 2 && parse_hex(tok[0], &addr) && is_ident(tok[1])) name = tok[1];
+    else if (n == 2 && is_ident(tok[0]) && parse_hex(tok[1], &addr)) name = tok[0];
+    if (!name || addr > 0xffff) continue;
+    add_symbol(addr, name);
+  }
+  fclose(f);
+  qsort(symbols, num_symbols, sizeof(t_symbol), cmp_symbols);
+  return 1;
+}
+
+static int find_symbol(const char *name) {
+  for (int i = 0; i < num_symbols; i++) {
+    if (!strcmp(symbols[i].name, name)) return i;
+  }
+  return -1;
+}
+
+// Индекс функции, которой принадлежит адрес (ближайший символ снизу)
+static int symbol_at(unsigned int addr) {
+  int lo = 0, hi = num_symbols - 1, found = -1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (symbols[mid].addr <= addr) {
+      found = mid;
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return found;
+}
+
+// === СЦЕНАРИЙ ВВОДА ===
+static int parse_keys(char *s, unsigned char *keys) {
+  static const struct { const char *name; unsigned char bit; } names[] = {
+    { "LEFT", 0x01 }, { "RIGHT", 0x02 }, { "UP", 0x04 }, { "DOWN", 0x08 }, { "FIRE", 0x10 }, { "NONE", 0 }
+  };
+  *keys = 0;
+  for (char *k = strtok(s, "+"); k; k = strtok(NULL, "+")) {
+    int found = 0;
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+      if (!strcmp(k, names[i].name)) {
+        *keys |= names[i].bit;
+        found = 1;
+      }
+    }
+    if (!found) return 0;
+  }
+  return 1;
+}
+
+static int load_script(const char *file_name) {
+  char line[256], keys[128];
+  unsigned int count;
+  FILE *f = fopen(file_name, "r");
+  if (!f) {
+    perror(file_name);
+    return 0;
+  }
+  while (fgets(line, sizeof(line), f) && num_steps < MAX_STEPS) {
+    int n;
+    if (line[0] == '#') continue;
+    n = sscanf(line, "%127s %u", keys, &count);
+    if (n < 1) continue;
+    if (n == 1) count = 1;
+    if (!parse_keys(keys, &steps[num_steps].keys)) {
+      fprintf(stderr, "%s: bad keys: %s", file_name, line);
+      fclose(f);
+      return 0;
+    }
+    steps[num_steps++].count = count;
+  }
+  fclose(f);
+  return 1;
+}
+
+static int load_image(const char *file_name, unsigned int org) {
+  size_t size;
+  FILE *f = fopen(file_name, "rb");
+  if (!f) {
+    perror(file_name);
+    return 0;
+  }
+  size = fread(mem + org, 1, sizeof(mem) - org, f);
+  fclose(f);
+  if (!size) {
+    fprintf(stderr, "%s: empty image\n", file_name);
+    return 0;
+  }
+  return 1;
+}
+
+// === ОТЧЁТ ===
+typedef struct {
+  int symbol;
+  uint64_t tstates;
+} t_func_stat;
+
+static int cmp_func_stats(const void *a, const void *b) {
+  const t_func_stat *fa = a, *fb = b;
+  return fa->tstates < fb->tstates ? 1 : fa->tstates > fb->tstates ? -1 : 0;
+}
+
+static void report(FILE *json, const char *rom, const char *script, const char *render_name) {
+  static t_func_stat funcs[MAX_SYMBOLS + 1];
+  int num_funcs = num_symbols + 1;   // Последний элемент — код вне известных символов
+  uint64_t total = 0, min = ~0ULL, max = 0, in_funcs = 0, contended = 0;
+  double avg;
+
+  for (int i = 0; i < num_renders; i++) {
+    total += renders[i];
+    if (renders[i] < min) min = renders[i];
+    if (renders[i] > max) max = renders[i];
+    contended += render_contended[i];
+  }
+  if (!num_renders) min = 0;
+  avg = num_renders ? (double)total / num_renders : 0;
+
+  for (int i = 0; i < num_funcs; i++) {
+    funcs[i].symbol = i < num_symbols ? i : -1;
+    funcs[i].tstates = 0;
+  }
+  for (unsigned int pc = 0; pc < 0x10000; pc++) {
+    int s;
+    if (!pc_tstates[pc]) continue;
+    s = symbol_at(pc);
+    funcs[s < 0 ? num_symbols : s].tstates += pc_tstates[pc];
+    in_funcs += pc_tstates[pc];
+  }
+  qsort(funcs, num_funcs, sizeof(t_func_stat), cmp_func_stats);
+
+  printf("%s: %d %s, startup %llu T\n", script, num_renders,
+         render_name ? "renders" : "loop iterations", (unsigned long long)startup_tstates);
+  printf("  T-states per frame: min %llu, avg %.0f, max %llu\n",
+         (unsigned long long)min, avg, (unsigned long long)max);
+  printf("  frames per second at 3.5 MHz: %.2f (%.2f TV frames per render)\n",
+         avg > 0 ? CPU_HZ / avg : 0.0, avg / FRAME_TSTATES);
+  printf("  contended memory: %.0f T per frame, screen writes %.0f (%.0f T) per frame\n",
+         num_renders ? (double)contended / num_renders : 0.0,
+         num_renders ? (double)render_screen_writes / num_renders : 0.0,
+         num_renders ? (double)render_screen_write_tstates / num_renders : 0.0);
+  for (int i = 0; i < num_funcs && funcs[i].tstates; i++) {
+    printf("  %-24s %12llu T %6.1f%%\n",
+           funcs[i].symbol < 0 ? "(unknown)" : symbols[funcs[i].symbol].name,
+           (unsigned long long)funcs[i].tstates, funcs[i].tstates * 100.0 / in_funcs);
+  }
+
+  if (!json) return;
+  fprintf(json, "{\n");
+  fprintf(json, "  \"rom\": \"%s\",\n  \"script\": \"%s\",\n", rom, script);
+  fprintf(json, "  \"frame_function\": %s%s%s,\n", render_name ? "\"" : "", render_name ? render_name : "null",
+          render_name ? "\"" : "");
+  fprintf(json, "  \"startup_tstates\": %llu,\n", (unsigned long long)startup_tstates);
+  fprintf(json, "  \"frames\": %d,\n", num_renders);
+  fprintf(json, "  \"tstates\": { \"min\": %llu, \"avg\": %.1f, \"max\": %llu, \"total\": %llu },\n",
+          (unsigned long long)min, avg, (unsigned long long)max, (unsigned long long)total);
+  fprintf(json, "  \"fps_3_5mhz\": %.3f,\n", avg > 0 ? CPU_HZ / avg : 0.0);
+  fprintf(json, "  \"contention\": { \"total_tstates\": %llu, \"frame_tstates\": %llu, \"screen_writes\": %llu, "
+          "\"screen_write_tstates\": %llu, \"frame_screen_writes\": %llu, \"frame_screen_write_tstates\": %llu },\n",
+          (unsigned long long)contended_tstates, (unsigned long long)contended, (unsigned long long)screen_writes,
+          (unsigned long long)screen_write_tstates, (unsigned long long)render_screen_writes,
+          (unsigned long long)render_screen_write_tstates);
+  fprintf(json, "  \"functions\": [");
+  for (int i = 0, first = 1; i < num_funcs && funcs[i].tstates; i++, first = 0) {
+    fprintf(json, "%s\n    { \"name\": \"%s\", \"tstates\": %llu, \"share\": %.4f }", first ? "" : ",",
+            funcs[i].symbol < 0 ? "(unknown)" : symbols[funcs[i].symbol].name,
+            (unsigned long long)funcs[i].tstates, (double)funcs[i].tstates / in_funcs);
+  }
+  fprintf(json, "\n  ],\n  \"per_frame\": [");
+  for (int i = 0; i < num_renders; i++) {
+    fprintf(json, "%s%s%llu", i ? "," : "", i % 16 ? " " : "\n    ", (unsigned long long)renders[i]);
+  }
+  fprintf(json, "\n  ]\n}\n");
+}
+
+int main(int argc, char *argv[]) {
+  unsigned int org = 0x5ccb, sp = 0xff58;
+  const char *map_file = NULL, *json_file = NULL, *dump_file = NULL, *render_name = "_engine_render";
+  uint64_t next_int = FRAME_TSTATES;
+  int opt;
+  z80 cpu;
+
+  for (opt = 1; opt + 1 < argc && argv[opt][0] == '-'; opt += 2) {
+    switch (argv[opt][1]) {
+      case 'o': parse_hex(argv[opt + 1], &org); break;
+      case 's': parse_hex(argv[opt + 1], &sp); break;
+      case 'm': map_file = argv[opt + 1]; break;
+      case 'e': render_name = argv[opt + 1]; break;
+      case 'j': json_file = argv[opt + 1]; break;
+      case 'd': dump_file = argv[opt + 1]; break;
+      default: opt = argc; break;
+    }
+  }
+  if (argc - opt != 2) {
+    fprintf(stderr, "Usage: %s [-o org] [-s sp] [-m symbols] [-e symbol] [-j out.json] [-d screen.scr] <rom> <script>\n", argv[0]);
+    return 2;
+  }
+  if (!load_image(argv[opt], org) || !load_script(argv[opt + 1])) return 2;
+  if (map_file && !load_symbols(map_file)) return 2;
+  if (num_symbols) {
+    int s = find_symbol(render_name);
+    if (s >= 0) render_addr = symbols[s].addr;
+  }
+  if (render_addr < 0) {
+    unsigned int addr;
+    if (parse_hex(render_name, &addr) && addr < 0x10000) render_addr = addr;
+  }
+  if (render_addr < 0) render_name = NULL;
+
+  z80_reset(&cpu);
+  cpu.read = mem_read;
+  cpu.write = mem_write;
+  cpu.in = port_in;
+  cpu.out = port_out;
+  cpu.pc = org;
+  cpu.sp = sp;
+
+  while (!script_done && cpu.cycles < MAX_TSTATES) {
+    uint16_t pc = cpu.pc;
+    uint64_t before = cpu.cycles;
+
+    if (pc < 0x4000) {
+      fprintf(stderr, "PC in ROM area (%04x) after %llu T, ROM is not emulated\n", pc, (unsigned long long)cpu.cycles);
+      return 1;
+    }
+
+    if (render_addr >= 0) {
+      if (!in_render && pc == render_addr) {
+        in_render = 1;
+        render_start = cpu.cycles;
+        render_contended_start = contended_tstates;
+        render_ret_sp = cpu.sp + 2;
+        render_ret_addr = mem[cpu.sp] | mem[(uint16_t)(cpu.sp + 1)] << 8;
+        if (!num_renders) startup_tstates = cpu.cycles;
+      } else if (in_render && pc == render_ret_addr && cpu.sp == render_ret_sp) {
+        in_render = 0;
+        if (num_renders < MAX_RENDERS) {
+          render_contended[num_renders] = contended_tstates - render_contended_start;
+          renders[num_renders++] = cpu.cycles - render_start;
+        }
+      }
+    } else if (!port_reads) {
+      startup_tstates = cpu.cycles;
+    }
+
+    // CALL nn / CALL cc,nn: запоминаем цель, если переход состоялся
+    uint8_t op = mem[pc];
+    uint16_t call_target = mem[(uint16_t)(pc + 1)] | mem[(uint16_t)(pc + 2)] << 8;
+    int is_call = op == 0xcd || (op & 0xc7) == 0xc4;
+
+    access_clock = cpu.cycles;
+    z80_step(&cpu);
+    if (is_call && cpu.pc == call_target) call_targets[call_target] = 1;
+    if (script_done) break;
+    if (in_render || (render_addr < 0 && port_reads)) pc_tstates[pc] += cpu.cycles - before;
+
+    if (cpu.cycles >= next_int) {
+      next_int += FRAME_TSTATES;
+      z80_interrupt(&cpu, 0xff);
+    } else if (cpu.halted && !cpu.iff1) {
+      fprintf(stderr, "HALT with interrupts disabled at %04x\n", pc);
+      return 1;
+    }
+  }
+
+  if (!map_file) {
+    symbols_from_calls(org);
+    qsort(symbols, num_symbols, sizeof(t_symbol), cmp_symbols);
+  }
+
+  if (dump_file) {
+    FILE *dump = fopen(dump_file, "wb");
+    if (!dump || fwrite(mem + 0x4000, 1, 6912, dump) != 6912) {
+      perror(dump_file);
+      return 2;
+    }
+    fclose(dump);
+  }
+
+  if (!script_done) fprintf(stderr, "warning: emulation limit reached before the script ended\n");
+
+  if (json_file) {
+    FILE *json = fopen(json_file, "w");
+    if (!json) {
+      perror(json_file);
+      return 2;
+    }
+    report(json, argv[opt], argv[opt + 1], render_name);
+    fclose(json);
+  } else {
+    report(NULL, argv[opt], argv[opt + 1], render_name);
+  }
+  return 0;
+}
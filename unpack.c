@@ -0,0 +1,66 @@
+#include <string.h>
+#include "unpack.h"
+
+#ifdef __SDCC
+// Параметры распаковщика (передаются через память, чтобы не зависеть от
+// соглашения о вызовах конкретной версии SDCC)
+static const unsigned char *lz_src;
+static unsigned char *lz_dst;
+
+// Литералы и повторы копируются одной LDIR: ~21 такт на байт
+static void lz_unpack_asm() __naked {
+  __asm
+    ld hl, (_lz_src)
+    ld de, (_lz_dst)
+    ld b, #0
+00001$:
+    ld a, (hl)
+    inc hl
+    cp #0xff
+    ret z                       ; Конец потока
+    or a
+    jp m, 00002$
+    inc a                       ; Литералы: token + 1 байт
+    ld c, a
+    ldir
+    jr 00001$
+00002$:
+    and #0x7f                   ; Повтор: (token & 0x7F) + 3 байта
+    add a, #3
+    ld c, a
+    ld a, (hl)
+    inc hl
+    push hl
+    ld l, a
+    ld h, #0xff                 ; HL = DE - смещение
+    add hl, de
+    ldir
+    pop hl
+    jr 00001$
+  __endasm;
+}
+
+void lz_unpack(const unsigned char *p_src, unsigned char *p_dst) {
+  lz_src = p_src;
+  lz_dst = p_dst;
+  lz_unpack_asm();
+}
+#else
+void lz_unpack(const unsigned char *p_src, unsigned char *p_dst) {
+  unsigned char token, count;
+  const unsigned char *p_match;
+
+  while ((token = *p_src++) != LZ_END) {
+    if (token & 0x80) {
+      count = (token & 0x7f) + LZ_MIN_MATCH;
+      p_match = p_dst - (LZ_MAX_OFFSET - *p_src++);
+      while (count--) *p_dst++ = *p_match++;
+    } else {
+      count = token + 1;
+      memcpy(p_dst, p_src, count);
+      p_src += count;
+      p_dst += count;
+    }
+  }
+}
+#endif
@@ -0,0 +1,20 @@
+#ifndef __UNPACK_H
+#define __UNPACK_H
+
+// === РАСПАКОВКА LZ ===
+// Байтовый формат (упаковщик — tools/extractor/extractor.py, pack_lz):
+//   0x00–0x7F  литералы: token + 1 байт (1–128) следуют за токеном
+//   0x80–0xFE  повтор: (token & 0x7F) + 3 байта (3–129) с позиции dst - смещение;
+//              следующий байт — 256 - смещение (смещение 1–256)
+//   0xFF       конец потока
+// Повтор копируется побайтно вперёд (как LDIR), поэтому может перекрываться
+// с приёмником — так кодируются серии одинаковых байт.
+#define LZ_MAX_LITERALS 128
+#define LZ_MIN_MATCH 3
+#define LZ_MAX_MATCH 129
+#define LZ_MAX_OFFSET 256
+#define LZ_END 0xff
+
+void lz_unpack(const unsigned char *p_src, unsigned char *p_dst);
+
+#endif // __UNPACK_H
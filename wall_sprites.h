@@ -3,279 +3,1016 @@
 
 #include <stddef.h>
 
+#define SPRITES_PACKED 1
+
+#ifndef BANKED_ASSETS
+#define BANKED_ASSETS 0
+#endif
+#if BANKED_ASSETS
+#define SPRITE_PIXELS(data) NULL
+#else
+#define SPRITE_PIXELS(data) data
+#endif
+
+#ifndef COMPILED_COLUMNS
+#define COMPILED_COLUMNS 0
+#endif
+
+typedef void (*t_column_fn)(char *p_buf, unsigned char rows);
+
 typedef struct {
     const unsigned char *p_sprite;
     const unsigned char *p_attributes;
+    const t_column_fn *p_columns;
     unsigned char width;
     unsigned char height;
 } t_sprite;
 
-const unsigned char corn_mature_4_sprite_data[] = /*{w:24,h:128,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x01, 0x80, 0x3E, 0x00, 0x40, 0x3E, 0x01,
-    0x80, 0x1E, 0x02, 0x07, 0xFC, 0x01, 0x87, 0xFC, 0x00, 0x47, 0xF8, 0x01, 0x01, 0xF0, 0x02, 0x01,
-    0xD0, 0x01, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x15, 0x00, 0x70, 0x0A, 0x00, 0x38, 0x05, 0x20, 0x3B,
-    0x82, 0x54, 0x1F, 0xE1, 0xAA, 0x1F, 0xF2, 0x54, 0x1F, 0xB1, 0x82, 0x3E, 0x12, 0x00, 0x38, 0x15,
-    0x00, 0x38, 0x12, 0x02, 0x30, 0x44, 0x07, 0xB0, 0xA2, 0x0F, 0xF1, 0x54, 0x3F, 0xF2, 0xAA, 0xFC,
-    0x78, 0x14, 0xF8, 0x39, 0x82, 0x00, 0x1B, 0xC0, 0xAA, 0x1F, 0xF0, 0x55, 0x1F, 0xFD, 0xAA, 0x9F,
-    0xFC, 0x45, 0x5E, 0x7E, 0x82, 0x9E, 0x16, 0x00, 0x1C, 0x02, 0x80, 0x3C, 0x03, 0x06, 0x38, 0x41,
-    0x0F, 0x30, 0xA1, 0x1F, 0xF1, 0x54, 0x3F, 0xF2, 0xAA, 0xFB, 0xF1, 0x54, 0xF1, 0xFA, 0x0A, 0x00,
-    0xF8, 0xE5, 0x00, 0x79, 0xE2, 0x00, 0x79, 0xF8, 0x2A, 0x3B, 0xFE, 0x55, 0x3B, 0xBE, 0xA0, 0x1F,
-    0x00, 0x40, 0x1E, 0x01, 0x80, 0x1E, 0x02, 0x40, 0x1E, 0x01, 0x80, 0x3C, 0x02, 0x0F, 0x1C, 0x01,
-    0x0F, 0x98, 0x7A, 0x0F, 0x98, 0xF9, 0x2F, 0xD9, 0xF2, 0x49, 0xDB, 0xF5, 0x28, 0xFB, 0xF2, 0x40,
-    0xFF, 0xF5, 0xAA, 0x7F, 0xF2, 0x54, 0x7F, 0xE5, 0xA8, 0x7F, 0xEA, 0x50, 0x3F, 0xC5, 0xA8, 0x1F,
-    0xC2, 0x50, 0x1F, 0x81, 0xA0, 0x1F, 0x82, 0x46, 0x1F, 0x01, 0xAE, 0x1F, 0x82, 0x4F, 0x1F, 0x81,
-    0x9F, 0x1F, 0xC2, 0x5F, 0x9F, 0xC1, 0x1F, 0x9B, 0xE2, 0x7F, 0xF9, 0xE5, 0x7F, 0xF9, 0xEA, 0x3B,
-    0xF8, 0xE5, 0x39, 0xF8, 0xF2, 0x30, 0xF8, 0xF5, 0x32, 0x78, 0x72, 0x74, 0x38, 0x75, 0x62, 0x38,
-    0x32, 0x60, 0x38, 0x14, 0xC2, 0x18, 0x90, 0x81, 0x19, 0x18, 0x80, 0x38, 0x08, 0x00, 0xF8, 0x08,
-    0x00, 0xF8, 0x0A, 0x01, 0xF8, 0x09, 0x01, 0xF8, 0x22, 0x01, 0xF8, 0x15, 0x01, 0xF8, 0x2A, 0x01,
-    0xF8, 0x15, 0x01, 0xF8, 0x2A, 0x01, 0xB8, 0x15, 0xA1, 0xBF, 0x82, 0x51, 0x9F, 0xC1, 0xA9, 0x3F,
-    0xE2, 0x55, 0x3F, 0xE1, 0x29, 0x39, 0xF2, 0x15, 0xB9, 0xF9, 0x09, 0xB8, 0xFA, 0x01, 0xB8, 0x79,
-    0x02, 0x38, 0x3C, 0x0F, 0x38, 0x19, 0x1D, 0xF8, 0x1A, 0x1C, 0xF8, 0x11, 0x38, 0x79, 0xB2, 0x38,
-    0x3F, 0xE5, 0x38, 0x1F, 0xE2, 0x38, 0x1F, 0xE1, 0x70, 0x1F, 0xE2, 0xF0, 0x1D, 0xE0, 0xE0, 0x39,
-    0xE0, 0xC4, 0x38, 0xE0, 0x0A, 0x38, 0xF0, 0x15, 0x38, 0xFD, 0x0A, 0xB8, 0x7C, 0x45, 0x3E, 0x7D
+#if !BANKED_ASSETS
+unsigned char corn_mature_4_sprite_data[384];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_mature_4_sprite_lz[] = {
+    0x00, 0x00, 0x98, 0xFF, 0x06, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x82, 0xFA, 0x6B, 0x38,
+    0x01, 0x80, 0x3E, 0x00, 0x40, 0x3E, 0x01, 0x80, 0x1E, 0x02, 0x07, 0xFC, 0x01, 0x87, 0xFC, 0x00,
+    0x47, 0xF8, 0x01, 0x01, 0xF0, 0x02, 0x01, 0xD0, 0x01, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x15, 0x00,
+    0x70, 0x0A, 0x00, 0x38, 0x05, 0x20, 0x3B, 0x82, 0x54, 0x1F, 0xE1, 0xAA, 0x1F, 0xF2, 0x54, 0x1F,
+    0xB1, 0x82, 0x3E, 0x12, 0x00, 0x38, 0x15, 0x00, 0x38, 0x12, 0x02, 0x30, 0x44, 0x07, 0xB0, 0xA2,
+    0x0F, 0xF1, 0x54, 0x3F, 0xF2, 0xAA, 0xFC, 0x78, 0x14, 0xF8, 0x39, 0x82, 0x00, 0x1B, 0xC0, 0xAA,
+    0x1F, 0xF0, 0x55, 0x1F, 0xFD, 0xAA, 0x9F, 0xFC, 0x45, 0x5E, 0x7E, 0x82, 0x9E, 0x16, 0x00, 0x1C,
+    0x02, 0x80, 0x3C, 0x03, 0x06, 0x38, 0x41, 0x0F, 0x30, 0xA1, 0x1F, 0x82, 0xD6, 0x19, 0xFB, 0xF1,
+    0x54, 0xF1, 0xFA, 0x0A, 0x00, 0xF8, 0xE5, 0x00, 0x79, 0xE2, 0x00, 0x79, 0xF8, 0x2A, 0x3B, 0xFE,
+    0x55, 0x3B, 0xBE, 0xA0, 0x1F, 0x00, 0x40, 0x1E, 0x81, 0x7C, 0x81, 0xFA, 0x63, 0x3C, 0x02, 0x0F,
+    0x1C, 0x01, 0x0F, 0x98, 0x7A, 0x0F, 0x98, 0xF9, 0x2F, 0xD9, 0xF2, 0x49, 0xDB, 0xF5, 0x28, 0xFB,
+    0xF2, 0x40, 0xFF, 0xF5, 0xAA, 0x7F, 0xF2, 0x54, 0x7F, 0xE5, 0xA8, 0x7F, 0xEA, 0x50, 0x3F, 0xC5,
+    0xA8, 0x1F, 0xC2, 0x50, 0x1F, 0x81, 0xA0, 0x1F, 0x82, 0x46, 0x1F, 0x01, 0xAE, 0x1F, 0x82, 0x4F,
+    0x1F, 0x81, 0x9F, 0x1F, 0xC2, 0x5F, 0x9F, 0xC1, 0x1F, 0x9B, 0xE2, 0x7F, 0xF9, 0xE5, 0x7F, 0xF9,
+    0xEA, 0x3B, 0xF8, 0xE5, 0x39, 0xF8, 0xF2, 0x30, 0xF8, 0xF5, 0x32, 0x78, 0x72, 0x74, 0x38, 0x75,
+    0x62, 0x38, 0x32, 0x60, 0x38, 0x14, 0xC2, 0x18, 0x90, 0x81, 0x19, 0x18, 0x80, 0x38, 0x08, 0x00,
+    0xF8, 0x80, 0xFD, 0x0C, 0x0A, 0x01, 0xF8, 0x09, 0x01, 0xF8, 0x22, 0x01, 0xF8, 0x15, 0x01, 0xF8,
+    0x2A, 0x84, 0xFA, 0x49, 0xB8, 0x15, 0xA1, 0xBF, 0x82, 0x51, 0x9F, 0xC1, 0xA9, 0x3F, 0xE2, 0x55,
+    0x3F, 0xE1, 0x29, 0x39, 0xF2, 0x15, 0xB9, 0xF9, 0x09, 0xB8, 0xFA, 0x01, 0xB8, 0x79, 0x02, 0x38,
+    0x3C, 0x0F, 0x38, 0x19, 0x1D, 0xF8, 0x1A, 0x1C, 0xF8, 0x11, 0x38, 0x79, 0xB2, 0x38, 0x3F, 0xE5,
+    0x38, 0x1F, 0xE2, 0x38, 0x1F, 0xE1, 0x70, 0x1F, 0xE2, 0xF0, 0x1D, 0xE0, 0xE0, 0x39, 0xE0, 0xC4,
+    0x38, 0xE0, 0x0A, 0x38, 0xF0, 0x15, 0x38, 0xFD, 0x0A, 0xB8, 0x7C, 0x45, 0x3E, 0x7D, 0xFF
 };
 
+#if COMPILED_COLUMNS
+static void corn_mature_4_column_0(char *p_buf, unsigned char rows) {
+    switch (rows) {
+    case 128: p_buf[4064] = 0x45;
+    case 127: p_buf[4032] = 0x0A;
+    case 126: p_buf[4000] = 0x15;
+    case 125: p_buf[3968] = 0x0A;
+    case 124: p_buf[3936] = 0xC4;
+    case 123: p_buf[3904] = 0xE0;
+    case 122: p_buf[3872] = 0xF0;
+    case 121: p_buf[3840] = 0x70;
+    case 120: p_buf[3808] = 0x38;
+    case 119: p_buf[3776] = 0x38;
+    case 118: p_buf[3744] = 0x38;
+    case 117: p_buf[3712] = 0x38;
+    case 116: p_buf[3680] = 0x1C;
+    case 115: p_buf[3648] = 0x1D;
+    case 114: p_buf[3616] = 0x0F;
+    case 113: p_buf[3584] = 0x02;
+    case 112: p_buf[3552] = 0x01;
+    case 111: p_buf[3520] = 0x09;
+    case 110: p_buf[3488] = 0x15;
+    case 109: p_buf[3456] = 0x29;
+    case 108: p_buf[3424] = 0x55;
+    case 107: p_buf[3392] = 0xA9;
+    case 106: p_buf[3360] = 0x51;
+    case 105: p_buf[3328] = 0xA1;
+    case 104: p_buf[3296] = 0x01;
+    case 103: p_buf[3264] = 0x01;
+    case 102: p_buf[3232] = 0x01;
+    case 101: p_buf[3200] = 0x01;
+    case 100: p_buf[3168] = 0x01;
+    case 99: p_buf[3136] = 0x01;
+    case 98: p_buf[3104] = 0x01;
+    case 97: p_buf[3072] = 0x00;
+    case 96: p_buf[3040] = 0x00;
+    case 95: p_buf[3008] = 0x80;
+    case 94: p_buf[2976] = 0x81;
+    case 93: p_buf[2944] = 0xC2;
+    case 92: p_buf[2912] = 0x60;
+    case 91: p_buf[2880] = 0x62;
+    case 90: p_buf[2848] = 0x74;
+    case 89: p_buf[2816] = 0x32;
+    case 88: p_buf[2784] = 0x30;
+    case 87: p_buf[2752] = 0x39;
+    case 86: p_buf[2720] = 0x3B;
+    case 85: p_buf[2688] = 0x7F;
+    case 84: p_buf[2656] = 0x7F;
+    case 83: p_buf[2624] = 0x1F;
+    case 82: p_buf[2592] = 0x5F;
+    case 81: p_buf[2560] = 0x9F;
+    case 80: p_buf[2528] = 0x4F;
+    case 79: p_buf[2496] = 0xAE;
+    case 78: p_buf[2464] = 0x46;
+    case 77: p_buf[2432] = 0xA0;
+    case 76: p_buf[2400] = 0x50;
+    case 75: p_buf[2368] = 0xA8;
+    case 74: p_buf[2336] = 0x50;
+    case 73: p_buf[2304] = 0xA8;
+    case 72: p_buf[2272] = 0x54;
+    case 71: p_buf[2240] = 0xAA;
+    case 70: p_buf[2208] = 0x40;
+    case 69: p_buf[2176] = 0x28;
+    case 68: p_buf[2144] = 0x49;
+    case 67: p_buf[2112] = 0x2F;
+    case 66: p_buf[2080] = 0x0F;
+    case 65: p_buf[2048] = 0x0F;
+    case 64: p_buf[2016] = 0x0F;
+    case 63: p_buf[1984] = 0x80;
+    case 62: p_buf[1952] = 0x40;
+    case 61: p_buf[1920] = 0x80;
+    case 60: p_buf[1888] = 0x40;
+    case 59: p_buf[1856] = 0xA0;
+    case 58: p_buf[1824] = 0x55;
+    case 57: p_buf[1792] = 0x2A;
+    case 56: p_buf[1760] = 0x00;
+    case 55: p_buf[1728] = 0x00;
+    case 54: p_buf[1696] = 0x00;
+    case 53: p_buf[1664] = 0xF1;
+    case 52: p_buf[1632] = 0xFB;
+    case 51: p_buf[1600] = 0x3F;
+    case 50: p_buf[1568] = 0x1F;
+    case 49: p_buf[1536] = 0x0F;
+    case 48: p_buf[1504] = 0x06;
+    case 47: p_buf[1472] = 0x80;
+    case 46: p_buf[1440] = 0x00;
+    case 45: p_buf[1408] = 0x82;
+    case 44: p_buf[1376] = 0x45;
+    case 43: p_buf[1344] = 0xAA;
+    case 42: p_buf[1312] = 0x55;
+    case 41: p_buf[1280] = 0xAA;
+    case 40: p_buf[1248] = 0x00;
+    case 39: p_buf[1216] = 0xF8;
+    case 38: p_buf[1184] = 0xFC;
+    case 37: p_buf[1152] = 0x3F;
+    case 36: p_buf[1120] = 0x0F;
+    case 35: p_buf[1088] = 0x07;
+    case 34: p_buf[1056] = 0x02;
+    case 33: p_buf[1024] = 0x00;
+    case 32: p_buf[992] = 0x00;
+    case 31: p_buf[960] = 0x82;
+    case 30: p_buf[928] = 0x54;
+    case 29: p_buf[896] = 0xAA;
+    case 28: p_buf[864] = 0x54;
+    case 27: p_buf[832] = 0x20;
+    case 26: p_buf[800] = 0x00;
+    case 25: p_buf[768] = 0x00;
+    case 24: p_buf[736] = 0x00;
+    case 23: p_buf[704] = 0x00;
+    case 22: p_buf[672] = 0x01;
+    case 21: p_buf[640] = 0x01;
+    case 20: p_buf[608] = 0x47;
+    case 19: p_buf[576] = 0x87;
+    case 18: p_buf[544] = 0x07;
+    case 17: p_buf[512] = 0x80;
+    case 16: p_buf[480] = 0x40;
+    case 15: p_buf[448] = 0x80;
+    case 14: p_buf[416] = 0x00;
+    case 13: p_buf[384] = 0x00;
+    case 12: p_buf[352] = 0x00;
+    case 11: p_buf[320] = 0x00;
+    case 10: p_buf[288] = 0x00;
+    case 9: p_buf[256] = 0x00;
+    case 8: p_buf[224] = 0x00;
+    case 7: p_buf[192] = 0x00;
+    case 6: p_buf[160] = 0x00;
+    case 5: p_buf[128] = 0x00;
+    case 4: p_buf[96] = 0x00;
+    case 3: p_buf[64] = 0x00;
+    case 2: p_buf[32] = 0x00;
+    case 1: p_buf[0] = 0x00;
+    }
+}
+
+static void corn_mature_4_column_1(char *p_buf, unsigned char rows) {
+    switch (rows) {
+    case 128: p_buf[4064] = 0x3E;
+    case 127: p_buf[4032] = 0xB8;
+    case 126: p_buf[4000] = 0x38;
+    case 125: p_buf[3968] = 0x38;
+    case 124: p_buf[3936] = 0x38;
+    case 123: p_buf[3904] = 0x39;
+    case 122: p_buf[3872] = 0x1D;
+    case 121: p_buf[3840] = 0x1F;
+    case 120: p_buf[3808] = 0x1F;
+    case 119: p_buf[3776] = 0x1F;
+    case 118: p_buf[3744] = 0x3F;
+    case 117: p_buf[3712] = 0x79;
+    case 116: p_buf[3680] = 0xF8;
+    case 115: p_buf[3648] = 0xF8;
+    case 114: p_buf[3616] = 0x38;
+    case 113: p_buf[3584] = 0x38;
+    case 112: p_buf[3552] = 0xB8;
+    case 111: p_buf[3520] = 0xB8;
+    case 110: p_buf[3488] = 0xB9;
+    case 109: p_buf[3456] = 0x39;
+    case 108: p_buf[3424] = 0x3F;
+    case 107: p_buf[3392] = 0x3F;
+    case 106: p_buf[3360] = 0x9F;
+    case 105: p_buf[3328] = 0xBF;
+    case 104: p_buf[3296] = 0xB8;
+    case 103: p_buf[3264] = 0xF8;
+    case 102: p_buf[3232] = 0xF8;
+    case 101: p_buf[3200] = 0xF8;
+    case 100: p_buf[3168] = 0xF8;
+    case 99: p_buf[3136] = 0xF8;
+    case 98: p_buf[3104] = 0xF8;
+    case 97: p_buf[3072] = 0xF8;
+    case 96: p_buf[3040] = 0xF8;
+    case 95: p_buf[3008] = 0x38;
+    case 94: p_buf[2976] = 0x19;
+    case 93: p_buf[2944] = 0x18;
+    case 92: p_buf[2912] = 0x38;
+    case 91: p_buf[2880] = 0x38;
+    case 90: p_buf[2848] = 0x38;
+    case 89: p_buf[2816] = 0x78;
+    case 88: p_buf[2784] = 0xF8;
+    case 87: p_buf[2752] = 0xF8;
+    case 86: p_buf[2720] = 0xF8;
+    case 85: p_buf[2688] = 0xF9;
+    case 84: p_buf[2656] = 0xF9;
+    case 83: p_buf[2624] = 0x9B;
+    case 82: p_buf[2592] = 0x9F;
+    case 81: p_buf[2560] = 0x1F;
+    case 80: p_buf[2528] = 0x1F;
+    case 79: p_buf[2496] = 0x1F;
+    case 78: p_buf[2464] = 0x1F;
+    case 77: p_buf[2432] = 0x1F;
+    case 76: p_buf[2400] = 0x1F;
+    case 75: p_buf[2368] = 0x1F;
+    case 74: p_buf[2336] = 0x3F;
+    case 73: p_buf[2304] = 0x7F;
+    case 72: p_buf[2272] = 0x7F;
+    case 71: p_buf[2240] = 0x7F;
+    case 70: p_buf[2208] = 0xFF;
+    case 69: p_buf[2176] = 0xFB;
+    case 68: p_buf[2144] = 0xDB;
+    case 67: p_buf[2112] = 0xD9;
+    case 66: p_buf[2080] = 0x98;
+    case 65: p_buf[2048] = 0x98;
+    case 64: p_buf[2016] = 0x1C;
+    case 63: p_buf[1984] = 0x3C;
+    case 62: p_buf[1952] = 0x1E;
+    case 61: p_buf[1920] = 0x1E;
+    case 60: p_buf[1888] = 0x1E;
+    case 59: p_buf[1856] = 0x1F;
+    case 58: p_buf[1824] = 0x3B;
+    case 57: p_buf[1792] = 0x3B;
+    case 56: p_buf[1760] = 0x79;
+    case 55: p_buf[1728] = 0x79;
+    case 54: p_buf[1696] = 0xF8;
+    case 53: p_buf[1664] = 0xFA;
+    case 52: p_buf[1632] = 0xF1;
+    case 51: p_buf[1600] = 0xF2;
+    case 50: p_buf[1568] = 0xF1;
+    case 49: p_buf[1536] = 0x30;
+    case 48: p_buf[1504] = 0x38;
+    case 47: p_buf[1472] = 0x3C;
+    case 46: p_buf[1440] = 0x1C;
+    case 45: p_buf[1408] = 0x9E;
+    case 44: p_buf[1376] = 0x5E;
+    case 43: p_buf[1344] = 0x9F;
+    case 42: p_buf[1312] = 0x1F;
+    case 41: p_buf[1280] = 0x1F;
+    case 40: p_buf[1248] = 0x1B;
+    case 39: p_buf[1216] = 0x39;
+    case 38: p_buf[1184] = 0x78;
+    case 37: p_buf[1152] = 0xF2;
+    case 36: p_buf[1120] = 0xF1;
+    case 35: p_buf[1088] = 0xB0;
+    case 34: p_buf[1056] = 0x30;
+    case 33: p_buf[1024] = 0x38;
+    case 32: p_buf[992] = 0x38;
+    case 31: p_buf[960] = 0x3E;
+    case 30: p_buf[928] = 0x1F;
+    case 29: p_buf[896] = 0x1F;
+    case 28: p_buf[864] = 0x1F;
+    case 27: p_buf[832] = 0x3B;
+    case 26: p_buf[800] = 0x38;
+    case 25: p_buf[768] = 0x70;
+    case 24: p_buf[736] = 0xF0;
+    case 23: p_buf[704] = 0xF0;
+    case 22: p_buf[672] = 0xD0;
+    case 21: p_buf[640] = 0xF0;
+    case 20: p_buf[608] = 0xF8;
+    case 19: p_buf[576] = 0xFC;
+    case 18: p_buf[544] = 0xFC;
+    case 17: p_buf[512] = 0x1E;
+    case 16: p_buf[480] = 0x3E;
+    case 15: p_buf[448] = 0x3E;
+    case 14: p_buf[416] = 0x38;
+    case 13: p_buf[384] = 0x18;
+    case 12: p_buf[352] = 0x10;
+    case 11: p_buf[320] = 0x18;
+    case 10: p_buf[288] = 0x0C;
+    case 9: p_buf[256] = 0x00;
+    case 8: p_buf[224] = 0x00;
+    case 7: p_buf[192] = 0x00;
+    case 6: p_buf[160] = 0x00;
+    case 5: p_buf[128] = 0x00;
+    case 4: p_buf[96] = 0x00;
+    case 3: p_buf[64] = 0x00;
+    case 2: p_buf[32] = 0x00;
+    case 1: p_buf[0] = 0x00;
+    }
+}
+
+static void corn_mature_4_column_2(char *p_buf, unsigned char rows) {
+    switch (rows) {
+    case 128: p_buf[4064] = 0x7D;
+    case 127: p_buf[4032] = 0x7C;
+    case 126: p_buf[4000] = 0xFD;
+    case 125: p_buf[3968] = 0xF0;
+    case 124: p_buf[3936] = 0xE0;
+    case 123: p_buf[3904] = 0xE0;
+    case 122: p_buf[3872] = 0xE0;
+    case 121: p_buf[3840] = 0xE2;
+    case 120: p_buf[3808] = 0xE1;
+    case 119: p_buf[3776] = 0xE2;
+    case 118: p_buf[3744] = 0xE5;
+    case 117: p_buf[3712] = 0xB2;
+    case 116: p_buf[3680] = 0x11;
+    case 115: p_buf[3648] = 0x1A;
+    case 114: p_buf[3616] = 0x19;
+    case 113: p_buf[3584] = 0x3C;
+    case 112: p_buf[3552] = 0x79;
+    case 111: p_buf[3520] = 0xFA;
+    case 110: p_buf[3488] = 0xF9;
+    case 109: p_buf[3456] = 0xF2;
+    case 108: p_buf[3424] = 0xE1;
+    case 107: p_buf[3392] = 0xE2;
+    case 106: p_buf[3360] = 0xC1;
+    case 105: p_buf[3328] = 0x82;
+    case 104: p_buf[3296] = 0x15;
+    case 103: p_buf[3264] = 0x2A;
+    case 102: p_buf[3232] = 0x15;
+    case 101: p_buf[3200] = 0x2A;
+    case 100: p_buf[3168] = 0x15;
+    case 99: p_buf[3136] = 0x22;
+    case 98: p_buf[3104] = 0x09;
+    case 97: p_buf[3072] = 0x0A;
+    case 96: p_buf[3040] = 0x08;
+    case 95: p_buf[3008] = 0x08;
+    case 94: p_buf[2976] = 0x18;
+    case 93: p_buf[2944] = 0x90;
+    case 92: p_buf[2912] = 0x14;
+    case 91: p_buf[2880] = 0x32;
+    case 90: p_buf[2848] = 0x75;
+    case 89: p_buf[2816] = 0x72;
+    case 88: p_buf[2784] = 0xF5;
+    case 87: p_buf[2752] = 0xF2;
+    case 86: p_buf[2720] = 0xE5;
+    case 85: p_buf[2688] = 0xEA;
+    case 84: p_buf[2656] = 0xE5;
+    case 83: p_buf[2624] = 0xE2;
+    case 82: p_buf[2592] = 0xC1;
+    case 81: p_buf[2560] = 0xC2;
+    case 80: p_buf[2528] = 0x81;
+    case 79: p_buf[2496] = 0x82;
+    case 78: p_buf[2464] = 0x01;
+    case 77: p_buf[2432] = 0x82;
+    case 76: p_buf[2400] = 0x81;
+    case 75: p_buf[2368] = 0xC2;
+    case 74: p_buf[2336] = 0xC5;
+    case 73: p_buf[2304] = 0xEA;
+    case 72: p_buf[2272] = 0xE5;
+    case 71: p_buf[2240] = 0xF2;
+    case 70: p_buf[2208] = 0xF5;
+    case 69: p_buf[2176] = 0xF2;
+    case 68: p_buf[2144] = 0xF5;
+    case 67: p_buf[2112] = 0xF2;
+    case 66: p_buf[2080] = 0xF9;
+    case 65: p_buf[2048] = 0x7A;
+    case 64: p_buf[2016] = 0x01;
+    case 63: p_buf[1984] = 0x02;
+    case 62: p_buf[1952] = 0x01;
+    case 61: p_buf[1920] = 0x02;
+    case 60: p_buf[1888] = 0x01;
+    case 59: p_buf[1856] = 0x00;
+    case 58: p_buf[1824] = 0xBE;
+    case 57: p_buf[1792] = 0xFE;
+    case 56: p_buf[1760] = 0xF8;
+    case 55: p_buf[1728] = 0xE2;
+    case 54: p_buf[1696] = 0xE5;
+    case 53: p_buf[1664] = 0x0A;
+    case 52: p_buf[1632] = 0x54;
+    case 51: p_buf[1600] = 0xAA;
+    case 50: p_buf[1568] = 0x54;
+    case 49: p_buf[1536] = 0xA1;
+    case 48: p_buf[1504] = 0x41;
+    case 47: p_buf[1472] = 0x03;
+    case 46: p_buf[1440] = 0x02;
+    case 45: p_buf[1408] = 0x16;
+    case 44: p_buf[1376] = 0x7E;
+    case 43: p_buf[1344] = 0xFC;
+    case 42: p_buf[1312] = 0xFD;
+    case 41: p_buf[1280] = 0xF0;
+    case 40: p_buf[1248] = 0xC0;
+    case 39: p_buf[1216] = 0x82;
+    case 38: p_buf[1184] = 0x14;
+    case 37: p_buf[1152] = 0xAA;
+    case 36: p_buf[1120] = 0x54;
+    case 35: p_buf[1088] = 0xA2;
+    case 34: p_buf[1056] = 0x44;
+    case 33: p_buf[1024] = 0x12;
+    case 32: p_buf[992] = 0x15;
+    case 31: p_buf[960] = 0x12;
+    case 30: p_buf[928] = 0xB1;
+    case 29: p_buf[896] = 0xF2;
+    case 28: p_buf[864] = 0xE1;
+    case 27: p_buf[832] = 0x82;
+    case 26: p_buf[800] = 0x05;
+    case 25: p_buf[768] = 0x0A;
+    case 24: p_buf[736] = 0x15;
+    case 23: p_buf[704] = 0x00;
+    case 22: p_buf[672] = 0x01;
+    case 21: p_buf[640] = 0x02;
+    case 20: p_buf[608] = 0x01;
+    case 19: p_buf[576] = 0x00;
+    case 18: p_buf[544] = 0x01;
+    case 17: p_buf[512] = 0x02;
+    case 16: p_buf[480] = 0x01;
+    case 15: p_buf[448] = 0x00;
+    case 14: p_buf[416] = 0x01;
+    case 13: p_buf[384] = 0x00;
+    case 12: p_buf[352] = 0x00;
+    case 11: p_buf[320] = 0x00;
+    case 10: p_buf[288] = 0x00;
+    case 9: p_buf[256] = 0x00;
+    case 8: p_buf[224] = 0x00;
+    case 7: p_buf[192] = 0x00;
+    case 6: p_buf[160] = 0x00;
+    case 5: p_buf[128] = 0x00;
+    case 4: p_buf[96] = 0x00;
+    case 3: p_buf[64] = 0x00;
+    case 2: p_buf[32] = 0x00;
+    case 1: p_buf[0] = 0x00;
+    }
+}
+
+static const t_column_fn corn_mature_4_columns[] = { corn_mature_4_column_0, corn_mature_4_column_1, corn_mature_4_column_2 };
+#endif
+
 static const t_sprite corn_mature_4 = {
-    .p_sprite = corn_mature_4_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_mature_4_sprite_data),
     .p_attributes = NULL,
+#if COMPILED_COLUMNS
+    .p_columns = corn_mature_4_columns,
+#else
+    .p_columns = NULL,
+#endif
     .width = 3,
     .height = 16
 };
 
-const unsigned char corn_mature_3_sprite_data[] = /*{w:16,h:80,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0xC0, 0x01, 0xC1, 0x01, 0x80, 0x01, 0x81,
-    0x0D, 0x08, 0x07, 0x05, 0x07, 0x02, 0x03, 0x01, 0xA1, 0xE0, 0x51, 0xF9, 0xA9, 0xF8, 0x45, 0xC5,
-    0x81, 0x80, 0x09, 0x01, 0x3F, 0x2A, 0x7F, 0x04, 0xE1, 0xA0, 0x01, 0xF8, 0xA9, 0xFE, 0x55, 0xFE,
-    0x81, 0xC2, 0x01, 0x81, 0x89, 0x89, 0x3D, 0x14, 0x7F, 0x2A, 0xEF, 0x01, 0x07, 0x98, 0x13, 0xBC,
-    0xA9, 0xBE, 0x41, 0xEE, 0x81, 0xC0, 0x41, 0xC1, 0x81, 0xC0, 0x1D, 0x89, 0x9D, 0xB8, 0x1F, 0xB9,
-    0x87, 0xF8, 0x57, 0xF9, 0xA3, 0xFA, 0x53, 0xF1, 0xA1, 0xF0, 0x41, 0xE1, 0x99, 0xE8, 0x19, 0xE1,
-    0xB9, 0xF0, 0x3D, 0xF1, 0x7F, 0xBA, 0x6F, 0xB9, 0x67, 0x9A, 0x63, 0x99, 0x61, 0x88, 0x41, 0x89,
-    0x81, 0x80, 0x81, 0x81, 0x07, 0x82, 0x07, 0x85, 0x87, 0x82, 0x07, 0x85, 0x87, 0x82, 0x07, 0x85,
-    0xA5, 0xE0, 0x55, 0xF1, 0xA1, 0xF8, 0x15, 0xBD, 0x85, 0x9C, 0x09, 0x8D, 0x9D, 0x84, 0x37, 0x85,
-    0x63, 0xA8, 0x61, 0xF9, 0x61, 0xF8, 0xE1, 0xB9, 0xC9, 0xB8, 0x11, 0x98, 0x89, 0x9E, 0x55, 0xDE
+#if !BANKED_ASSETS
+unsigned char corn_mature_3_sprite_data[160];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_mature_3_sprite_lz[] = {
+    0x0B, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x01, 0xC0, 0x01, 0xC1, 0x80, 0xFA, 0x69,
+    0x81, 0x0D, 0x08, 0x07, 0x05, 0x07, 0x02, 0x03, 0x01, 0xA1, 0xE0, 0x51, 0xF9, 0xA9, 0xF8, 0x45,
+    0xC5, 0x81, 0x80, 0x09, 0x01, 0x3F, 0x2A, 0x7F, 0x04, 0xE1, 0xA0, 0x01, 0xF8, 0xA9, 0xFE, 0x55,
+    0xFE, 0x81, 0xC2, 0x01, 0x81, 0x89, 0x89, 0x3D, 0x14, 0x7F, 0x2A, 0xEF, 0x01, 0x07, 0x98, 0x13,
+    0xBC, 0xA9, 0xBE, 0x41, 0xEE, 0x81, 0xC0, 0x41, 0xC1, 0x81, 0xC0, 0x1D, 0x89, 0x9D, 0xB8, 0x1F,
+    0xB9, 0x87, 0xF8, 0x57, 0xF9, 0xA3, 0xFA, 0x53, 0xF1, 0xA1, 0xF0, 0x41, 0xE1, 0x99, 0xE8, 0x19,
+    0xE1, 0xB9, 0xF0, 0x3D, 0xF1, 0x7F, 0xBA, 0x6F, 0xB9, 0x67, 0x9A, 0x63, 0x99, 0x61, 0x88, 0x41,
+    0x89, 0x81, 0x80, 0x81, 0x81, 0x07, 0x82, 0x07, 0x85, 0x87, 0x84, 0xFC, 0x1F, 0xA5, 0xE0, 0x55,
+    0xF1, 0xA1, 0xF8, 0x15, 0xBD, 0x85, 0x9C, 0x09, 0x8D, 0x9D, 0x84, 0x37, 0x85, 0x63, 0xA8, 0x61,
+    0xF9, 0x61, 0xF8, 0xE1, 0xB9, 0xC9, 0xB8, 0x11, 0x98, 0x89, 0x9E, 0x55, 0xDE, 0xFF
 };
 
+#if COMPILED_COLUMNS
+static void corn_mature_3_column_0(char *p_buf, unsigned char rows) {
+    switch (rows) {
+    case 80: p_buf[2528] = 0x55;
+    case 79: p_buf[2496] = 0x89;
+    case 78: p_buf[2464] = 0x11;
+    case 77: p_buf[2432] = 0xC9;
+    case 76: p_buf[2400] = 0xE1;
+    case 75: p_buf[2368] = 0x61;
+    case 74: p_buf[2336] = 0x61;
+    case 73: p_buf[2304] = 0x63;
+    case 72: p_buf[2272] = 0x37;
+    case 71: p_buf[2240] = 0x9D;
+    case 70: p_buf[2208] = 0x09;
+    case 69: p_buf[2176] = 0x85;
+    case 68: p_buf[2144] = 0x15;
+    case 67: p_buf[2112] = 0xA1;
+    case 66: p_buf[2080] = 0x55;
+    case 65: p_buf[2048] = 0xA5;
+    case 64: p_buf[2016] = 0x07;
+    case 63: p_buf[1984] = 0x87;
+    case 62: p_buf[1952] = 0x07;
+    case 61: p_buf[1920] = 0x87;
+    case 60: p_buf[1888] = 0x07;
+    case 59: p_buf[1856] = 0x07;
+    case 58: p_buf[1824] = 0x81;
+    case 57: p_buf[1792] = 0x81;
+    case 56: p_buf[1760] = 0x41;
+    case 55: p_buf[1728] = 0x61;
+    case 54: p_buf[1696] = 0x63;
+    case 53: p_buf[1664] = 0x67;
+    case 52: p_buf[1632] = 0x6F;
+    case 51: p_buf[1600] = 0x7F;
+    case 50: p_buf[1568] = 0x3D;
+    case 49: p_buf[1536] = 0xB9;
+    case 48: p_buf[1504] = 0x19;
+    case 47: p_buf[1472] = 0x99;
+    case 46: p_buf[1440] = 0x41;
+    case 45: p_buf[1408] = 0xA1;
+    case 44: p_buf[1376] = 0x53;
+    case 43: p_buf[1344] = 0xA3;
+    case 42: p_buf[1312] = 0x57;
+    case 41: p_buf[1280] = 0x87;
+    case 40: p_buf[1248] = 0x1F;
+    case 39: p_buf[1216] = 0x9D;
+    case 38: p_buf[1184] = 0x1D;
+    case 37: p_buf[1152] = 0x81;
+    case 36: p_buf[1120] = 0x41;
+    case 35: p_buf[1088] = 0x81;
+    case 34: p_buf[1056] = 0x41;
+    case 33: p_buf[1024] = 0xA9;
+    case 32: p_buf[992] = 0x13;
+    case 31: p_buf[960] = 0x07;
+    case 30: p_buf[928] = 0xEF;
+    case 29: p_buf[896] = 0x7F;
+    case 28: p_buf[864] = 0x3D;
+    case 27: p_buf[832] = 0x89;
+    case 26: p_buf[800] = 0x01;
+    case 25: p_buf[768] = 0x81;
+    case 24: p_buf[736] = 0x55;
+    case 23: p_buf[704] = 0xA9;
+    case 22: p_buf[672] = 0x01;
+    case 21: p_buf[640] = 0xE1;
+    case 20: p_buf[608] = 0x7F;
+    case 19: p_buf[576] = 0x3F;
+    case 18: p_buf[544] = 0x09;
+    case 17: p_buf[512] = 0x81;
+    case 16: p_buf[480] = 0x45;
+    case 15: p_buf[448] = 0xA9;
+    case 14: p_buf[416] = 0x51;
+    case 13: p_buf[384] = 0xA1;
+    case 12: p_buf[352] = 0x03;
+    case 11: p_buf[320] = 0x07;
+    case 10: p_buf[288] = 0x07;
+    case 9: p_buf[256] = 0x0D;
+    case 8: p_buf[224] = 0x01;
+    case 7: p_buf[192] = 0x01;
+    case 6: p_buf[160] = 0x01;
+    case 5: p_buf[128] = 0x01;
+    case 4: p_buf[96] = 0x01;
+    case 3: p_buf[64] = 0x01;
+    case 2: p_buf[32] = 0x00;
+    case 1: p_buf[0] = 0x00;
+    }
+}
+
+static void corn_mature_3_column_1(char *p_buf, unsigned char rows) {
+    switch (rows) {
+    case 80: p_buf[2528] = 0xDE;
+    case 79: p_buf[2496] = 0x9E;
+    case 78: p_buf[2464] = 0x98;
+    case 77: p_buf[2432] = 0xB8;
+    case 76: p_buf[2400] = 0xB9;
+    case 75: p_buf[2368] = 0xF8;
+    case 74: p_buf[2336] = 0xF9;
+    case 73: p_buf[2304] = 0xA8;
+    case 72: p_buf[2272] = 0x85;
+    case 71: p_buf[2240] = 0x84;
+    case 70: p_buf[2208] = 0x8D;
+    case 69: p_buf[2176] = 0x9C;
+    case 68: p_buf[2144] = 0xBD;
+    case 67: p_buf[2112] = 0xF8;
+    case 66: p_buf[2080] = 0xF1;
+    case 65: p_buf[2048] = 0xE0;
+    case 64: p_buf[2016] = 0x85;
+    case 63: p_buf[1984] = 0x82;
+    case 62: p_buf[1952] = 0x85;
+    case 61: p_buf[1920] = 0x82;
+    case 60: p_buf[1888] = 0x85;
+    case 59: p_buf[1856] = 0x82;
+    case 58: p_buf[1824] = 0x81;
+    case 57: p_buf[1792] = 0x80;
+    case 56: p_buf[1760] = 0x89;
+    case 55: p_buf[1728] = 0x88;
+    case 54: p_buf[1696] = 0x99;
+    case 53: p_buf[1664] = 0x9A;
+    case 52: p_buf[1632] = 0xB9;
+    case 51: p_buf[1600] = 0xBA;
+    case 50: p_buf[1568] = 0xF1;
+    case 49: p_buf[1536] = 0xF0;
+    case 48: p_buf[1504] = 0xE1;
+    case 47: p_buf[1472] = 0xE8;
+    case 46: p_buf[1440] = 0xE1;
+    case 45: p_buf[1408] = 0xF0;
+    case 44: p_buf[1376] = 0xF1;
+    case 43: p_buf[1344] = 0xFA;
+    case 42: p_buf[1312] = 0xF9;
+    case 41: p_buf[1280] = 0xF8;
+    case 40: p_buf[1248] = 0xB9;
+    case 39: p_buf[1216] = 0xB8;
+    case 38: p_buf[1184] = 0x89;
+    case 37: p_buf[1152] = 0xC0;
+    case 36: p_buf[1120] = 0xC1;
+    case 35: p_buf[1088] = 0xC0;
+    case 34: p_buf[1056] = 0xEE;
+    case 33: p_buf[1024] = 0xBE;
+    case 32: p_buf[992] = 0xBC;
+    case 31: p_buf[960] = 0x98;
+    case 30: p_buf[928] = 0x01;
+    case 29: p_buf[896] = 0x2A;
+    case 28: p_buf[864] = 0x14;
+    case 27: p_buf[832] = 0x89;
+    case 26: p_buf[800] = 0x81;
+    case 25: p_buf[768] = 0xC2;
+    case 24: p_buf[736] = 0xFE;
+    case 23: p_buf[704] = 0xFE;
+    case 22: p_buf[672] = 0xF8;
+    case 21: p_buf[640] = 0xA0;
+    case 20: p_buf[608] = 0x04;
+    case 19: p_buf[576] = 0x2A;
+    case 18: p_buf[544] = 0x01;
+    case 17: p_buf[512] = 0x80;
+    case 16: p_buf[480] = 0xC5;
+    case 15: p_buf[448] = 0xF8;
+    case 14: p_buf[416] = 0xF9;
+    case 13: p_buf[384] = 0xE0;
+    case 12: p_buf[352] = 0x01;
+    case 11: p_buf[320] = 0x02;
+    case 10: p_buf[288] = 0x05;
+    case 9: p_buf[256] = 0x08;
+    case 8: p_buf[224] = 0x81;
+    case 7: p_buf[192] = 0x80;
+    case 6: p_buf[160] = 0xC1;
+    case 5: p_buf[128] = 0xC0;
+    case 4: p_buf[96] = 0x80;
+    case 3: p_buf[64] = 0x00;
+    case 2: p_buf[32] = 0x80;
+    case 1: p_buf[0] = 0x00;
+    }
+}
+
+static const t_column_fn corn_mature_3_columns[] = { corn_mature_3_column_0, corn_mature_3_column_1 };
+#endif
+
 static const t_sprite corn_mature_3 = {
-    .p_sprite = corn_mature_3_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_mature_3_sprite_data),
     .p_attributes = NULL,
+#if COMPILED_COLUMNS
+    .p_columns = corn_mature_3_columns,
+#else
+    .p_columns = NULL,
+#endif
     .width = 2,
     .height = 10
 };
 
-const unsigned char corn_mature_2_sprite_data[] = /*{w:8,h:48,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x10, 0x28, 0x10, 0x11, 0x98, 0x19, 0x32, 0x31, 0x10, 0x4E, 0x98,
-    0x31, 0xF0, 0x0E, 0x8F, 0x19, 0x70, 0xF0, 0x16, 0x5E, 0x08, 0x6A, 0x7E, 0x1E, 0x9C, 0x0C, 0x6C,
-    0x7C, 0xF4, 0x96, 0x92, 0x10, 0x32, 0x31, 0x30, 0x3C, 0x9E, 0x32, 0x72, 0x5C, 0xCC, 0x96, 0x1A
+#if !BANKED_ASSETS
+unsigned char corn_mature_2_sprite_data[48];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_mature_2_sprite_lz[] = {
+    0x00, 0x00, 0x80, 0xFF, 0x2B, 0x28, 0x10, 0x28, 0x10, 0x11, 0x98, 0x19, 0x32, 0x31, 0x10, 0x4E,
+    0x98, 0x31, 0xF0, 0x0E, 0x8F, 0x19, 0x70, 0xF0, 0x16, 0x5E, 0x08, 0x6A, 0x7E, 0x1E, 0x9C, 0x0C,
+    0x6C, 0x7C, 0xF4, 0x96, 0x92, 0x10, 0x32, 0x31, 0x30, 0x3C, 0x9E, 0x32, 0x72, 0x5C, 0xCC, 0x96,
+    0x1A, 0xFF
 };
 
+#if COMPILED_COLUMNS
+static void corn_mature_2_column_0(char *p_buf, unsigned char rows) {
+    switch (rows) {
+    case 48: p_buf[1504] = 0x1A;
+    case 47: p_buf[1472] = 0x96;
+    case 46: p_buf[1440] = 0xCC;
+    case 45: p_buf[1408] = 0x5C;
+    case 44: p_buf[1376] = 0x72;
+    case 43: p_buf[1344] = 0x32;
+    case 42: p_buf[1312] = 0x9E;
+    case 41: p_buf[1280] = 0x3C;
+    case 40: p_buf[1248] = 0x30;
+    case 39: p_buf[1216] = 0x31;
+    case 38: p_buf[1184] = 0x32;
+    case 37: p_buf[1152] = 0x10;
+    case 36: p_buf[1120] = 0x92;
+    case 35: p_buf[1088] = 0x96;
+    case 34: p_buf[1056] = 0xF4;
+    case 33: p_buf[1024] = 0x7C;
+    case 32: p_buf[992] = 0x6C;
+    case 31: p_buf[960] = 0x0C;
+    case 30: p_buf[928] = 0x9C;
+    case 29: p_buf[896] = 0x1E;
+    case 28: p_buf[864] = 0x7E;
+    case 27: p_buf[832] = 0x6A;
+    case 26: p_buf[800] = 0x08;
+    case 25: p_buf[768] = 0x5E;
+    case 24: p_buf[736] = 0x16;
+    case 23: p_buf[704] = 0xF0;
+    case 22: p_buf[672] = 0x70;
+    case 21: p_buf[640] = 0x19;
+    case 20: p_buf[608] = 0x8F;
+    case 19: p_buf[576] = 0x0E;
+    case 18: p_buf[544] = 0xF0;
+    case 17: p_buf[512] = 0x31;
+    case 16: p_buf[480] = 0x98;
+    case 15: p_buf[448] = 0x4E;
+    case 14: p_buf[416] = 0x10;
+    case 13: p_buf[384] = 0x31;
+    case 12: p_buf[352] = 0x32;
+    case 11: p_buf[320] = 0x19;
+    case 10: p_buf[288] = 0x98;
+    case 9: p_buf[256] = 0x11;
+    case 8: p_buf[224] = 0x10;
+    case 7: p_buf[192] = 0x28;
+    case 6: p_buf[160] = 0x10;
+    case 5: p_buf[128] = 0x28;
+    case 4: p_buf[96] = 0x00;
+    case 3: p_buf[64] = 0x00;
+    case 2: p_buf[32] = 0x00;
+    case 1: p_buf[0] = 0x00;
+    }
+}
+
+static const t_column_fn corn_mature_2_columns[] = { corn_mature_2_column_0 };
+#endif
+
 static const t_sprite corn_mature_2 = {
-    .p_sprite = corn_mature_2_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_mature_2_sprite_data),
     .p_attributes = NULL,
+#if COMPILED_COLUMNS
+    .p_columns = corn_mature_2_columns,
+#else
+    .p_columns = NULL,
+#endif
     .width = 1,
     .height = 6
 };
 
-const unsigned char corn_mature_1_sprite_data[] = /*{w:8,h:24,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x44, 0x22, 0x42, 0x22, 0x44, 0xCC, 0x22, 0x66, 0x66, 0x22,
-    0xEE, 0x44, 0x00, 0x44, 0x66, 0x44, 0xAA, 0x33
+#if !BANKED_ASSETS
+unsigned char corn_mature_1_sprite_data[24];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_mature_1_sprite_lz[] = {
+    0x00, 0x00, 0x81, 0xFF, 0x12, 0x22, 0x44, 0x22, 0x42, 0x22, 0x44, 0xCC, 0x22, 0x66, 0x66, 0x22,
+    0xEE, 0x44, 0x00, 0x44, 0x66, 0x44, 0xAA, 0x33, 0xFF
 };
 
+#if COMPILED_COLUMNS
+static void corn_mature_1_column_0(char *p_buf, unsigned char rows) {
+    switch (rows) {
+    case 24: p_buf[736] = 0x33;
+    case 23: p_buf[704] = 0xAA;
+    case 22: p_buf[672] = 0x44;
+    case 21: p_buf[640] = 0x66;
+    case 20: p_buf[608] = 0x44;
+    case 19: p_buf[576] = 0x00;
+    case 18: p_buf[544] = 0x44;
+    case 17: p_buf[512] = 0xEE;
+    case 16: p_buf[480] = 0x22;
+    case 15: p_buf[448] = 0x66;
+    case 14: p_buf[416] = 0x66;
+    case 13: p_buf[384] = 0x22;
+    case 12: p_buf[352] = 0xCC;
+    case 11: p_buf[320] = 0x44;
+    case 10: p_buf[288] = 0x22;
+    case 9: p_buf[256] = 0x42;
+    case 8: p_buf[224] = 0x22;
+    case 7: p_buf[192] = 0x44;
+    case 6: p_buf[160] = 0x22;
+    case 5: p_buf[128] = 0x00;
+    case 4: p_buf[96] = 0x00;
+    case 3: p_buf[64] = 0x00;
+    case 2: p_buf[32] = 0x00;
+    case 1: p_buf[0] = 0x00;
+    }
+}
+
+static const t_column_fn corn_mature_1_columns[] = { corn_mature_1_column_0 };
+#endif
+
 static const t_sprite corn_mature_1 = {
-    .p_sprite = corn_mature_1_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_mature_1_sprite_data),
     .p_attributes = NULL,
+#if COMPILED_COLUMNS
+    .p_columns = corn_mature_1_columns,
+#else
+    .p_columns = NULL,
+#endif
     .width = 1,
     .height = 3
 };
 
-const unsigned char corn_mature_0_sprite_data[] = /*{w:8,h:8,bpp:1,brev:1}*/{
-    0x00, 0x55, 0x00, 0x55, 0x22, 0x55, 0x89, 0x55
+#if !BANKED_ASSETS
+unsigned char corn_mature_0_sprite_data[8];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_mature_0_sprite_lz[] = {
+    0x07, 0x00, 0x55, 0x00, 0x55, 0x22, 0x55, 0x89, 0x55, 0xFF
 };
 
+#if COMPILED_COLUMNS
+static void corn_mature_0_column_0(char *p_buf, unsigned char rows) {
+    switch (rows) {
+    case 8: p_buf[224] = 0x55;
+    case 7: p_buf[192] = 0x89;
+    case 6: p_buf[160] = 0x55;
+    case 5: p_buf[128] = 0x22;
+    case 4: p_buf[96] = 0x55;
+    case 3: p_buf[64] = 0x00;
+    case 2: p_buf[32] = 0x55;
+    case 1: p_buf[0] = 0x00;
+    }
+}
+
+static const t_column_fn corn_mature_0_columns[] = { corn_mature_0_column_0 };
+#endif
+
 static const t_sprite corn_mature_0 = {
-    .p_sprite = corn_mature_0_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_mature_0_sprite_data),
     .p_attributes = NULL,
+#if COMPILED_COLUMNS
+    .p_columns = corn_mature_0_columns,
+#else
+    .p_columns = NULL,
+#endif
     .width = 1,
     .height = 1
 };
 
-const unsigned char corn_ripening_4_sprite_data[] = /*{w:24,h:128,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xB0, 0x00, 0x1E, 0x12, 0x00, 0x38, 0x14,
-    0x00, 0x38, 0x12, 0x02, 0x30, 0x44, 0x07, 0xB0, 0xA2, 0x0F, 0xF1, 0x54, 0x3F, 0xF2, 0xAA, 0xFC,
-    0x78, 0x14, 0xF8, 0x39, 0x82, 0x00, 0x1B, 0xC0, 0xAA, 0x1F, 0xF0, 0x55, 0x1F, 0xFD, 0xAA, 0x9F,
-    0xFC, 0x45, 0x5E, 0x7E, 0x82, 0x9E, 0x16, 0x00, 0x1C, 0x02, 0x80, 0x3C, 0x03, 0x06, 0x38, 0x41,
-    0x0F, 0x30, 0xA1, 0x1F, 0xF1, 0x54, 0x3F, 0xF2, 0xAA, 0xFB, 0xF1, 0x54, 0xF1, 0xFA, 0x0A, 0x00,
-    0xF8, 0xE5, 0x00, 0x79, 0xE2, 0x00, 0x79, 0xF8, 0x2A, 0x3B, 0xFE, 0x55, 0x3B, 0xBE, 0xA0, 0x1F,
-    0x00, 0x40, 0x1E, 0x01, 0x80, 0x1E, 0x02, 0x40, 0x1E, 0x01, 0x80, 0x3C, 0x02, 0x0F, 0x1C, 0x01,
-    0x0F, 0x98, 0x02, 0x0F, 0x98, 0x81, 0x2F, 0xD9, 0xE2, 0x49, 0xDB, 0xC5, 0x28, 0xFB, 0x82, 0x40,
-    0xFF, 0x85, 0xA0, 0x7F, 0x02, 0x50, 0x7E, 0x05, 0xA0, 0x7E, 0x02, 0x40, 0x3C, 0x05, 0xA0, 0x1C,
-    0x02, 0x40, 0x1C, 0x01, 0x80, 0x1E, 0x02, 0x46, 0x1F, 0x01, 0x8E, 0x1F, 0x82, 0x0F, 0x1F, 0x81,
-    0x9F, 0x1F, 0xC2, 0x1F, 0x9F, 0xC1, 0x1F, 0x9B, 0xE2, 0x7F, 0xF9, 0xE5, 0x7F, 0xF9, 0xEA, 0x3B,
-    0xF8, 0xE5, 0x39, 0xF8, 0xF2, 0x30, 0xF8, 0xF5, 0x32, 0x78, 0x72, 0x74, 0x38, 0x75, 0x62, 0x38,
-    0x32, 0x60, 0x38, 0x14, 0xC2, 0x18, 0x90, 0x81, 0x19, 0x18, 0x80, 0x38, 0x08, 0x00, 0xF8, 0x08
+#if !BANKED_ASSETS
+unsigned char corn_ripening_4_sprite_data[384];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_ripening_4_sprite_lz[] = {
+    0x00, 0x00, 0xFE, 0xFF, 0xAD, 0xFF, 0x41, 0x03, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xB0, 0x00,
+    0x1E, 0x12, 0x00, 0x38, 0x14, 0x00, 0x38, 0x12, 0x02, 0x30, 0x44, 0x07, 0xB0, 0xA2, 0x0F, 0xF1,
+    0x54, 0x3F, 0xF2, 0xAA, 0xFC, 0x78, 0x14, 0xF8, 0x39, 0x82, 0x00, 0x1B, 0xC0, 0xAA, 0x1F, 0xF0,
+    0x55, 0x1F, 0xFD, 0xAA, 0x9F, 0xFC, 0x45, 0x5E, 0x7E, 0x82, 0x9E, 0x16, 0x00, 0x1C, 0x02, 0x80,
+    0x3C, 0x03, 0x06, 0x38, 0x41, 0x0F, 0x30, 0xA1, 0x1F, 0x82, 0xD6, 0x1D, 0xFB, 0xF1, 0x54, 0xF1,
+    0xFA, 0x0A, 0x00, 0xF8, 0xE5, 0x00, 0x79, 0xE2, 0x00, 0x79, 0xF8, 0x2A, 0x3B, 0xFE, 0x55, 0x3B,
+    0xBE, 0xA0, 0x1F, 0x00, 0x40, 0x1E, 0x01, 0x80, 0x1E, 0x02, 0x81, 0xFA, 0x27, 0x3C, 0x02, 0x0F,
+    0x1C, 0x01, 0x0F, 0x98, 0x02, 0x0F, 0x98, 0x81, 0x2F, 0xD9, 0xE2, 0x49, 0xDB, 0xC5, 0x28, 0xFB,
+    0x82, 0x40, 0xFF, 0x85, 0xA0, 0x7F, 0x02, 0x50, 0x7E, 0x05, 0xA0, 0x7E, 0x02, 0x40, 0x3C, 0x05,
+    0xA0, 0x1C, 0x02, 0x40, 0x1C, 0x81, 0xD0, 0x38, 0x46, 0x1F, 0x01, 0x8E, 0x1F, 0x82, 0x0F, 0x1F,
+    0x81, 0x9F, 0x1F, 0xC2, 0x1F, 0x9F, 0xC1, 0x1F, 0x9B, 0xE2, 0x7F, 0xF9, 0xE5, 0x7F, 0xF9, 0xEA,
+    0x3B, 0xF8, 0xE5, 0x39, 0xF8, 0xF2, 0x30, 0xF8, 0xF5, 0x32, 0x78, 0x72, 0x74, 0x38, 0x75, 0x62,
+    0x38, 0x32, 0x60, 0x38, 0x14, 0xC2, 0x18, 0x90, 0x81, 0x19, 0x18, 0x80, 0x38, 0x08, 0x00, 0xF8,
+    0x08, 0xFF
 };
 
 static const t_sprite corn_ripening_4 = {
-    .p_sprite = corn_ripening_4_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_ripening_4_sprite_data),
     .p_attributes = NULL,
+    .p_columns = NULL,
     .width = 3,
     .height = 16
 };
 
-const unsigned char corn_ripening_3_sprite_data[] = /*{w:16,h:80,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x70, 0x00, 0xC8, 0x00, 0xC4,
-    0x01, 0x80, 0x09, 0x01, 0x3F, 0x2A, 0x7F, 0x04, 0xE1, 0xA0, 0x01, 0xF8, 0xA9, 0xFC, 0x55, 0xFE,
-    0x81, 0xC2, 0x01, 0x81, 0x89, 0x89, 0x3D, 0x14, 0x7F, 0x2A, 0xEF, 0x01, 0x07, 0x98, 0x13, 0xBC,
-    0xA9, 0xBE, 0x41, 0xEE, 0x81, 0xC0, 0x41, 0xC1, 0x81, 0xC0, 0x1D, 0x81, 0x9D, 0x90, 0x1F, 0xB9,
-    0x87, 0xE8, 0x57, 0xE9, 0xA3, 0xEA, 0x53, 0xE1, 0xA1, 0xE0, 0x41, 0xE1, 0x99, 0xE8, 0x19, 0xE1,
-    0xB9, 0xF0, 0x3D, 0xF1, 0x7F, 0xBA, 0x6F, 0xB9, 0x67, 0x9A, 0x63, 0x99, 0x61, 0x88, 0x41, 0x89
+#if !BANKED_ASSETS
+unsigned char corn_ripening_3_sprite_data[160];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_ripening_3_sprite_lz[] = {
+    0x00, 0x00, 0xC5, 0xFF, 0x56, 0x20, 0x00, 0x70, 0x00, 0xC8, 0x00, 0xC4, 0x01, 0x80, 0x09, 0x01,
+    0x3F, 0x2A, 0x7F, 0x04, 0xE1, 0xA0, 0x01, 0xF8, 0xA9, 0xFC, 0x55, 0xFE, 0x81, 0xC2, 0x01, 0x81,
+    0x89, 0x89, 0x3D, 0x14, 0x7F, 0x2A, 0xEF, 0x01, 0x07, 0x98, 0x13, 0xBC, 0xA9, 0xBE, 0x41, 0xEE,
+    0x81, 0xC0, 0x41, 0xC1, 0x81, 0xC0, 0x1D, 0x81, 0x9D, 0x90, 0x1F, 0xB9, 0x87, 0xE8, 0x57, 0xE9,
+    0xA3, 0xEA, 0x53, 0xE1, 0xA1, 0xE0, 0x41, 0xE1, 0x99, 0xE8, 0x19, 0xE1, 0xB9, 0xF0, 0x3D, 0xF1,
+    0x7F, 0xBA, 0x6F, 0xB9, 0x67, 0x9A, 0x63, 0x99, 0x61, 0x88, 0x41, 0x89, 0xFF
 };
 
 static const t_sprite corn_ripening_3 = {
-    .p_sprite = corn_ripening_3_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_ripening_3_sprite_data),
     .p_attributes = NULL,
+    .p_columns = NULL,
     .width = 2,
     .height = 10
 };
 
-const unsigned char corn_ripening_2_sprite_data[] = /*{w:8,h:48,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0E, 0x0F, 0x19, 0x70, 0xF0, 0x16, 0x5E, 0x08, 0x6A, 0x7E, 0x1E, 0x9C, 0x0C, 0x6C, 0x7C,
-    0xF4, 0x96, 0x92, 0x10, 0x32, 0x31, 0x30, 0x3C, 0x9E, 0x32, 0x72, 0x5C, 0xCC, 0x96, 0x1A, 0x00
+#if !BANKED_ASSETS
+unsigned char corn_ripening_2_sprite_data[48];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_ripening_2_sprite_lz[] = {
+    0x00, 0x00, 0x84, 0xFF, 0x00, 0x80, 0x85, 0xF7, 0x1E, 0x0E, 0x0F, 0x19, 0x70, 0xF0, 0x16, 0x5E,
+    0x08, 0x6A, 0x7E, 0x1E, 0x9C, 0x0C, 0x6C, 0x7C, 0xF4, 0x96, 0x92, 0x10, 0x32, 0x31, 0x30, 0x3C,
+    0x9E, 0x32, 0x72, 0x5C, 0xCC, 0x96, 0x1A, 0x00, 0xFF
 };
 
 static const t_sprite corn_ripening_2 = {
-    .p_sprite = corn_ripening_2_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_ripening_2_sprite_data),
     .p_attributes = NULL,
+    .p_columns = NULL,
     .width = 1,
     .height = 6
 };
 
-const unsigned char corn_ripening_1_sprite_data[] = /*{w:8,h:24,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x44, 0x66, 0x22,
-    0xEE, 0x44, 0x00, 0x44, 0x66, 0x44, 0xAA, 0x33
+#if !BANKED_ASSETS
+unsigned char corn_ripening_1_sprite_data[24];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_ripening_1_sprite_lz[] = {
+    0x00, 0x00, 0x88, 0xFF, 0x0B, 0x22, 0x44, 0x66, 0x22, 0xEE, 0x44, 0x00, 0x44, 0x66, 0x44, 0xAA,
+    0x33, 0xFF
 };
 
 static const t_sprite corn_ripening_1 = {
-    .p_sprite = corn_ripening_1_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_ripening_1_sprite_data),
     .p_attributes = NULL,
+    .p_columns = NULL,
     .width = 1,
     .height = 3
 };
 
-const unsigned char corn_ripening_0_sprite_data[] = /*{w:8,h:8,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x55, 0x22, 0x55, 0x89, 0x55
+#if !BANKED_ASSETS
+unsigned char corn_ripening_0_sprite_data[8];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_ripening_0_sprite_lz[] = {
+    0x07, 0x00, 0x00, 0x00, 0x55, 0x22, 0x55, 0x89, 0x55, 0xFF
 };
 
 static const t_sprite corn_ripening_0 = {
-    .p_sprite = corn_ripening_0_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_ripening_0_sprite_data),
     .p_attributes = NULL,
+    .p_columns = NULL,
     .width = 1,
     .height = 1
 };
 
-const unsigned char corn_baby_4_sprite_data[] = /*{w:24,h:128,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xB0, 0x00, 0x1E, 0x12, 0x00, 0x38, 0x14,
-    0x00, 0x38, 0x12, 0x02, 0x30, 0x44, 0x07, 0xB0, 0xA2, 0x0F, 0xF1, 0x54, 0x3F, 0xF2, 0xAA, 0xFC,
-    0x78, 0x14, 0xF8, 0x39, 0x82, 0x00, 0x1B, 0xC0, 0xAA, 0x1F, 0xF0, 0x55, 0x1F, 0xFD, 0xAA, 0x9F,
-    0xFC, 0x45, 0x5E, 0x7E, 0x82, 0x9E, 0x16, 0x00, 0x1C, 0x02, 0x80, 0x3C, 0x03, 0x00, 0x38, 0x01
+#if !BANKED_ASSETS
+unsigned char corn_baby_4_sprite_data[384];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_baby_4_sprite_lz[] = {
+    0x00, 0x00, 0xFE, 0xFF, 0xFE, 0xFF, 0xBC, 0xFF, 0x3D, 0x03, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x1F,
+    0xB0, 0x00, 0x1E, 0x12, 0x00, 0x38, 0x14, 0x00, 0x38, 0x12, 0x02, 0x30, 0x44, 0x07, 0xB0, 0xA2,
+    0x0F, 0xF1, 0x54, 0x3F, 0xF2, 0xAA, 0xFC, 0x78, 0x14, 0xF8, 0x39, 0x82, 0x00, 0x1B, 0xC0, 0xAA,
+    0x1F, 0xF0, 0x55, 0x1F, 0xFD, 0xAA, 0x9F, 0xFC, 0x45, 0x5E, 0x7E, 0x82, 0x9E, 0x16, 0x00, 0x1C,
+    0x02, 0x80, 0x3C, 0x03, 0x00, 0x38, 0x01, 0xFF
 };
 
 static const t_sprite corn_baby_4 = {
-    .p_sprite = corn_baby_4_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_baby_4_sprite_data),
     .p_attributes = NULL,
+    .p_columns = NULL,
     .width = 3,
     .height = 16
 };
 
-const unsigned char corn_baby_3_sprite_data[] = /*{w:16,h:80,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x70, 0x00, 0xC8, 0x00, 0xC4,
-    0x01, 0x80, 0x09, 0x01, 0x3F, 0x2A, 0x7F, 0x04, 0xE1, 0xA0, 0x01, 0xF8, 0xA9, 0xCC, 0x55, 0x06
+#if !BANKED_ASSETS
+unsigned char corn_baby_3_sprite_data[160];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_baby_3_sprite_lz[] = {
+    0x00, 0x00, 0xFE, 0xFF, 0x84, 0xFF, 0x16, 0x20, 0x00, 0x70, 0x00, 0xC8, 0x00, 0xC4, 0x01, 0x80,
+    0x09, 0x01, 0x3F, 0x2A, 0x7F, 0x04, 0xE1, 0xA0, 0x01, 0xF8, 0xA9, 0xCC, 0x55, 0x06, 0xFF
 };
 
 static const t_sprite corn_baby_3 = {
-    .p_sprite = corn_baby_3_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_baby_3_sprite_data),
     .p_attributes = NULL,
+    .p_columns = NULL,
     .width = 2,
     .height = 10
 };
 
-const unsigned char corn_baby_2_sprite_data[] = /*{w:8,h:48,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x19, 0x70, 0xF0, 0x16, 0x5E
+#if !BANKED_ASSETS
+unsigned char corn_baby_2_sprite_data[48];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_baby_2_sprite_lz[] = {
+    0x00, 0x00, 0xA5, 0xFF, 0x06, 0x0E, 0x0F, 0x19, 0x70, 0xF0, 0x16, 0x5E, 0xFF
 };
 
 static const t_sprite corn_baby_2 = {
-    .p_sprite = corn_baby_2_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_baby_2_sprite_data),
     .p_attributes = NULL,
+    .p_columns = NULL,
     .width = 1,
     .height = 6
 };
 
-const unsigned char corn_baby_1_sprite_data[] = /*{w:8,h:24,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x44, 0x66, 0x22
+#if !BANKED_ASSETS
+unsigned char corn_baby_1_sprite_data[24];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_baby_1_sprite_lz[] = {
+    0x00, 0x00, 0x90, 0xFF, 0x03, 0x22, 0x44, 0x66, 0x22, 0xFF
 };
 
 static const t_sprite corn_baby_1 = {
-    .p_sprite = corn_baby_1_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_baby_1_sprite_data),
     .p_attributes = NULL,
+    .p_columns = NULL,
     .width = 1,
     .height = 3
 };
 
-const unsigned char corn_baby_0_sprite_data[] = /*{w:8,h:8,bpp:1,brev:1}*/{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55
+#if !BANKED_ASSETS
+unsigned char corn_baby_0_sprite_data[8];  // Заполняется lz_unpack()
+#endif
+const unsigned char corn_baby_0_sprite_lz[] = {
+    0x00, 0x00, 0x83, 0xFF, 0x00, 0x55, 0xFF
 };
 
 static const t_sprite corn_baby_0 = {
-    .p_sprite = corn_baby_0_sprite_data,
+    .p_sprite = SPRITE_PIXELS(corn_baby_0_sprite_data),
     .p_attributes = NULL,
+    .p_columns = NULL,
     .width = 1,
     .height = 1
 };
@@ -300,4 +1037,327 @@ static const t_sprite * const all_sprites[] = {
 
 static const size_t num_sprites = 15;
 
+typedef struct {
+    const unsigned char *p_packed;
+    unsigned char *p_data;
+    unsigned int size;
+    unsigned int packed_size;
+} t_packed;
+
+static const t_packed packed_sprites[] = {
+    { corn_mature_4_sprite_lz, SPRITE_PIXELS(corn_mature_4_sprite_data), 384, 351 },
+    { corn_mature_3_sprite_lz, SPRITE_PIXELS(corn_mature_3_sprite_data), 160, 158 },
+    { corn_mature_2_sprite_lz, SPRITE_PIXELS(corn_mature_2_sprite_data), 48, 50 },
+    { corn_mature_1_sprite_lz, SPRITE_PIXELS(corn_mature_1_sprite_data), 24, 25 },
+    { corn_mature_0_sprite_lz, SPRITE_PIXELS(corn_mature_0_sprite_data), 8, 10 },
+    { corn_ripening_4_sprite_lz, SPRITE_PIXELS(corn_ripening_4_sprite_data), 384, 210 },
+    { corn_ripening_3_sprite_lz, SPRITE_PIXELS(corn_ripening_3_sprite_data), 160, 93 },
+    { corn_ripening_2_sprite_lz, SPRITE_PIXELS(corn_ripening_2_sprite_data), 48, 41 },
+    { corn_ripening_1_sprite_lz, SPRITE_PIXELS(corn_ripening_1_sprite_data), 24, 18 },
+    { corn_ripening_0_sprite_lz, SPRITE_PIXELS(corn_ripening_0_sprite_data), 8, 10 },
+    { corn_baby_4_sprite_lz, SPRITE_PIXELS(corn_baby_4_sprite_data), 384, 72 },
+    { corn_baby_3_sprite_lz, SPRITE_PIXELS(corn_baby_3_sprite_data), 160, 31 },
+    { corn_baby_2_sprite_lz, SPRITE_PIXELS(corn_baby_2_sprite_data), 48, 13 },
+    { corn_baby_1_sprite_lz, SPRITE_PIXELS(corn_baby_1_sprite_data), 24, 10 },
+    { corn_baby_0_sprite_lz, SPRITE_PIXELS(corn_baby_0_sprite_data), 8, 7 },
+};
+
+static const size_t num_packed_sprites = 15;
+
+const unsigned char splash_lz[] = {
+    0x00, 0x00, 0x94, 0xFF, 0x04, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0x95, 0xE3, 0x80, 0xE1, 0x04, 0xE0,
+    0xFF, 0xF7, 0xFE, 0x7F, 0x80, 0xDA, 0x85, 0xF0, 0x86, 0xE7, 0x00, 0xDF, 0x81, 0xFB, 0x08, 0xFE,
+    0x3F, 0xE6, 0x40, 0x70, 0x00, 0x01, 0xFF, 0xE0, 0x88, 0xE1, 0x00, 0xFF, 0x82, 0xFF, 0x00, 0xE0,
+    0x81, 0xFB, 0x04, 0xF1, 0xFF, 0xFE, 0x00, 0x7F, 0x80, 0xE4, 0x00, 0x1F, 0x88, 0x91, 0x06, 0xFE,
+    0xC1, 0xC0, 0x0F, 0xFC, 0x00, 0x1F, 0x81, 0xDD, 0x03, 0x1F, 0xFF, 0xC0, 0x07, 0x80, 0xEC, 0x01,
+    0xE0, 0x7F, 0x87, 0xE1, 0x01, 0x0F, 0x80, 0x81, 0xF9, 0x07, 0x01, 0xFC, 0xAA, 0x79, 0xFF, 0xF0,
+    0xF9, 0xF4, 0x81, 0xD0, 0x82, 0xCB, 0x85, 0xE1, 0x00, 0xFC, 0x86, 0xD6, 0x07, 0x07, 0xE0, 0xFF,
+    0xE0, 0x03, 0x00, 0xFF, 0xC0, 0x80, 0x64, 0x02, 0x00, 0x00, 0x8F, 0x84, 0xEB, 0x02, 0xFC, 0x3F,
+    0xF8, 0x80, 0xFA, 0x00, 0x7F, 0x81, 0xDA, 0x03, 0x40, 0x01, 0xFC, 0x03, 0x83, 0x76, 0x00, 0x07,
+    0x81, 0xFB, 0x97, 0x1F, 0x02, 0xFE, 0x1F, 0x9F, 0x99, 0x00, 0x00, 0xC7, 0x80, 0xC3, 0x00, 0x9F,
+    0x91, 0x00, 0x00, 0x9F, 0x82, 0x70, 0x03, 0x3F, 0xF0, 0x80, 0x30, 0x80, 0x8E, 0x00, 0xE1, 0x8E,
+    0x00, 0x82, 0xFF, 0x05, 0x8F, 0xFF, 0xF8, 0x01, 0xFF, 0xF0, 0x8B, 0x00, 0x05, 0xFC, 0x1E, 0x0F,
+    0x0F, 0xF8, 0x05, 0x81, 0x00, 0x04, 0xC0, 0x5B, 0xFF, 0x80, 0x3F, 0x89, 0x21, 0x80, 0x3F, 0x00,
+    0xE0, 0x83, 0xF8, 0x06, 0x18, 0x02, 0x79, 0xFF, 0xE0, 0x38, 0x6C, 0x80, 0x1F, 0x8B, 0x00, 0x84,
+    0xE1, 0x0B, 0x20, 0x00, 0x00, 0x4F, 0xE0, 0x1F, 0xC0, 0x07, 0x00, 0xFF, 0xD8, 0xFF, 0x8A, 0x00,
+    0x00, 0x1F, 0x81, 0x00, 0x02, 0xFF, 0xFC, 0x08, 0x81, 0x00, 0x02, 0xBF, 0xE0, 0x7F, 0x81, 0x7C,
+    0x00, 0xFE, 0x81, 0x95, 0x98, 0x00, 0x02, 0xF8, 0x1C, 0x27, 0x99, 0x00, 0x81, 0xC2, 0x88, 0x00,
+    0x81, 0x0A, 0x82, 0xFF, 0x01, 0xFE, 0x07, 0x81, 0xE2, 0x02, 0xF9, 0xFF, 0xF1, 0x81, 0x73, 0x00,
+    0x7F, 0x86, 0x5F, 0x8A, 0x00, 0x04, 0xFE, 0x0F, 0x7F, 0xE0, 0x03, 0x81, 0x00, 0x00, 0x7F, 0x88,
+    0x00, 0x06, 0xC3, 0xE0, 0x3F, 0x8F, 0xF0, 0x00, 0x8F, 0x80, 0xE1, 0x02, 0x83, 0xE7, 0xFF, 0x82,
+    0xE6, 0x88, 0x62, 0x81, 0x41, 0x83, 0xFF, 0x04, 0x79, 0xFF, 0x80, 0x1C, 0x30, 0x80, 0x1F, 0x8B,
+    0x00, 0x00, 0x80, 0x86, 0xE0, 0x03, 0x0F, 0xC0, 0x07, 0x80, 0x80, 0xE1, 0x00, 0xA3, 0x82, 0x00,
+    0x85, 0xE0, 0x01, 0xF0, 0x07, 0x81, 0xBF, 0x01, 0x7F, 0xFC, 0x80, 0xFB, 0x04, 0x40, 0x01, 0xA3,
+    0xFD, 0x03, 0x82, 0x7A, 0x00, 0x7F, 0x9B, 0x00, 0x01, 0xE9, 0xFC, 0x99, 0x00, 0x05, 0xFE, 0x3F,
+    0xFF, 0xFF, 0xE0, 0x0F, 0x87, 0x7E, 0x00, 0x87, 0x85, 0xE7, 0x01, 0xFC, 0x03, 0x81, 0xC3, 0x01,
+    0xE3, 0xFF, 0x82, 0x4E, 0x00, 0x3F, 0x85, 0xE1, 0x00, 0xEF, 0x81, 0xEB, 0x01, 0xF0, 0x0F, 0x84,
+    0x00, 0x05, 0xF8, 0x3E, 0x7F, 0xC0, 0x0F, 0xFF, 0x80, 0x72, 0x88, 0x00, 0x07, 0xF8, 0x03, 0xC0,
+    0x3F, 0x87, 0xE0, 0x00, 0x41, 0x80, 0xE1, 0x02, 0x03, 0xE7, 0xFC, 0x82, 0x46, 0x88, 0x62, 0x00,
+    0xF0, 0x83, 0xF9, 0x08, 0x40, 0x00, 0x02, 0x79, 0xFF, 0x07, 0x8E, 0x00, 0x1F, 0x8D, 0x00, 0x84,
+    0xF8, 0x0A, 0x20, 0x00, 0x00, 0x4F, 0xC7, 0xE7, 0x00, 0x3F, 0x00, 0xFF, 0x87, 0x90, 0x00, 0x01,
+    0xFF, 0xFE, 0x82, 0x00, 0x02, 0xAC, 0x9F, 0x83, 0x84, 0x78, 0x9A, 0x00, 0x02, 0xC7, 0xFE, 0x13,
+    0x98, 0x00, 0x04, 0xFC, 0x37, 0xFF, 0xFF, 0xC0, 0x91, 0x00, 0x01, 0xF8, 0x0F, 0x81, 0xC3, 0x00,
+    0x47, 0x83, 0x00, 0x00, 0x1F, 0x85, 0xE1, 0x00, 0xE7, 0x81, 0xEB, 0x02, 0xE0, 0x05, 0x7F, 0x83,
+    0x8B, 0x04, 0xF1, 0xFD, 0xFF, 0x40, 0x3F, 0x80, 0x72, 0x00, 0x01, 0x87, 0x9F, 0x06, 0xFF, 0xB8,
+    0x3E, 0x00, 0x3F, 0x03, 0xE0, 0x81, 0xAE, 0x03, 0xFE, 0x63, 0xE6, 0x70, 0x82, 0xE6, 0x88, 0x62,
+    0x01, 0xF8, 0x3E, 0x84, 0x00, 0x06, 0x00, 0x39, 0xFE, 0x1F, 0xE1, 0x00, 0x7F, 0x8C, 0x00, 0x81,
+    0x27, 0x03, 0x00, 0x00, 0x0F, 0xE0, 0x81, 0xFB, 0x01, 0xC0, 0x20, 0x80, 0xE1, 0x02, 0xFE, 0x07,
+    0xFF, 0x81, 0x8C, 0x89, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xFC, 0x82, 0x00, 0x02, 0xB5, 0x42, 0xFC,
+    0x80, 0x7C, 0x04, 0xFE, 0x7F, 0xFF, 0xF8, 0x1F, 0x98, 0x00, 0x03, 0xFE, 0x1F, 0xFF, 0x18, 0x98,
+    0x00, 0x07, 0xF1, 0x97, 0xF3, 0xFF, 0x00, 0x03, 0x00, 0xFD, 0x85, 0xDD, 0x00, 0x9F, 0x86, 0x56,
+    0x00, 0x1F, 0x81, 0x67, 0x03, 0x1F, 0xFF, 0xE0, 0x06, 0x81, 0x73, 0x85, 0xE1, 0x00, 0x87, 0x81,
+    0xEB, 0x02, 0xCF, 0xF0, 0x3F, 0x83, 0x00, 0x04, 0xE7, 0xFD, 0xDF, 0x00, 0x7F, 0x80, 0x84, 0x00,
+    0x03, 0x88, 0x00, 0x0D, 0x03, 0xC0, 0x00, 0x3C, 0x03, 0xE0, 0x7E, 0x4E, 0x1F, 0xFF, 0xFC, 0x63,
+    0xF2, 0x30, 0x80, 0x41, 0x8A, 0x00, 0x00, 0xF0, 0x83, 0x00, 0x06, 0x00, 0x00, 0x02, 0x11, 0xFC,
+    0x3F, 0xE1, 0x80, 0x28, 0x01, 0xFE, 0x7F, 0x81, 0xDF, 0x81, 0xFB, 0x82, 0x53, 0x00, 0x07, 0x81,
+    0x05, 0x01, 0x1F, 0xF8, 0x81, 0x20, 0x01, 0x00, 0x08, 0x80, 0x00, 0x80, 0x7F, 0x01, 0x00, 0xC3,
+    0x89, 0x00, 0x04, 0xFC, 0x00, 0xFC, 0x00, 0xFF, 0x83, 0x00, 0x02, 0xAA, 0x85, 0xEE, 0x80, 0x83,
+    0x06, 0xFC, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0x03, 0x96, 0x1F, 0x03, 0xF8, 0x3F, 0xFF, 0x9C, 0x98,
+    0x00, 0x03, 0xD1, 0x89, 0xA1, 0xFC, 0x80, 0x00, 0x00, 0xF8, 0x85, 0xDD, 0x86, 0xD5, 0x01, 0xF0,
+    0x3F, 0x80, 0xFB, 0x05, 0xFC, 0x7F, 0xFF, 0xC0, 0x1F, 0x80, 0x88, 0x00, 0x00, 0x0F, 0x81, 0xEB,
+    0x02, 0x05, 0x3F, 0x83, 0x83, 0x00, 0x03, 0x0F, 0xF7, 0xFC, 0x01, 0x80, 0xF9, 0x87, 0xE1, 0x03,
+    0x00, 0x00, 0xE0, 0x7C, 0x81, 0xFA, 0x08, 0x6F, 0xFF, 0x00, 0xC7, 0xFF, 0xF0, 0xE1, 0xF8, 0x80,
+    0x80, 0x41, 0x8A, 0x00, 0x00, 0xF8, 0x85, 0x00, 0x04, 0x00, 0x01, 0xFC, 0x7F, 0xF8, 0x80, 0x92,
+    0x01, 0xFC, 0x1F, 0x81, 0x09, 0x81, 0xA9, 0x81, 0xFF, 0x00, 0xFC, 0x82, 0x00, 0x02, 0x3F, 0xFC,
+    0x08, 0x81, 0x20, 0x81, 0x73, 0x01, 0xFF, 0xBF, 0x8D, 0x00, 0x03, 0x03, 0xFC, 0x00, 0x7F, 0x83,
+    0x00, 0x05, 0xAD, 0x45, 0x5E, 0x3F, 0xFC, 0x0F, 0x80, 0x03, 0x02, 0xFF, 0x87, 0xFC, 0x80, 0xD3,
+    0x94, 0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0xFE, 0x7F, 0x97, 0x00, 0x07, 0x87, 0xC9, 0x81, 0xFC, 0x00,
+    0x01, 0x00, 0xE0, 0x85, 0xDD, 0x86, 0x55, 0x82, 0xEE, 0x80, 0xC3, 0x02, 0x80, 0x1F, 0xC0, 0x88,
+    0x00, 0x81, 0x52, 0x05, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x80, 0x08, 0x03, 0xF8, 0x1F, 0xF7,
+    0xF0, 0x81, 0x00, 0x00, 0x80, 0x88, 0x00, 0x01, 0x00, 0x78, 0x81, 0xFB, 0x08, 0x17, 0xFE, 0x00,
+    0xE3, 0xFF, 0xF0, 0xF0, 0xFC, 0x00, 0x8D, 0x00, 0x00, 0xF0, 0x83, 0xF9, 0x0B, 0x20, 0x00, 0x02,
+    0x47, 0xF8, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0xE2, 0x3F, 0x81, 0xDF, 0x86, 0x00, 0x01, 0x3F, 0xF8,
+    0x80, 0xFA, 0x00, 0x7F, 0x83, 0x00, 0x01, 0xE0, 0x01, 0x80, 0x00, 0x80, 0xC4, 0x00, 0x03, 0x8B,
+    0x00, 0x00, 0xFF, 0x85, 0x00, 0x0C, 0xFA, 0x86, 0xAA, 0x3F, 0xF8, 0x05, 0xFC, 0x1F, 0xFF, 0xFF,
+    0x83, 0xF8, 0xD8, 0x87, 0xE0, 0x01, 0xEF, 0x00, 0x80, 0xEA, 0x81, 0xE0, 0x06, 0x95, 0x59, 0x15,
+    0x9F, 0xF0, 0x00, 0x7F, 0x80, 0x56, 0x02, 0x83, 0xF3, 0xBC, 0x84, 0x20, 0x00, 0x3F, 0x81, 0xB6,
+    0x12, 0x3F, 0x80, 0x02, 0x10, 0x02, 0x00, 0x01, 0x37, 0xFF, 0xFE, 0x00, 0x00, 0x1E, 0x0F, 0xF8,
+    0xFF, 0xFC, 0x07, 0xF7, 0x81, 0x58, 0x00, 0x83, 0x80, 0x93, 0x00, 0xFC, 0x80, 0x25, 0x00, 0x60,
+    0x80, 0xDD, 0x04, 0x1C, 0x02, 0x07, 0xE0, 0xCF, 0x80, 0xF8, 0x08, 0xFE, 0x00, 0x7F, 0xFF, 0x00,
+    0xC0, 0xF0, 0x00, 0x3C, 0x80, 0x59, 0x05, 0xE7, 0xF0, 0x7F, 0x07, 0x00, 0x80, 0x83, 0xB8, 0x04,
+    0x10, 0x00, 0x00, 0x50, 0xCF, 0x80, 0x61, 0x02, 0xF7, 0xFF, 0xFF, 0x80, 0xF9, 0x00, 0x7F, 0x81,
+    0x59, 0x06, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0xFF, 0x87, 0x80, 0xF5, 0x04, 0xFF, 0xFF, 0x4D, 0x4F,
+    0x9F, 0x80, 0xFA, 0x06, 0x78, 0xFF, 0xE0, 0x00, 0x07, 0xC0, 0x01, 0x81, 0xEF, 0x00, 0x81, 0x80,
+    0x3C, 0x05, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xC0, 0x84, 0x36, 0x83, 0x11, 0x00, 0x17, 0x80, 0xC0,
+    0x01, 0xF9, 0xF0, 0x80, 0x5E, 0x04, 0xFF, 0xFF, 0x0D, 0x55, 0xE0, 0x83, 0xE2, 0x01, 0xFF, 0xF0,
+    0x83, 0xE3, 0x01, 0x01, 0xF0, 0x80, 0xB0, 0x02, 0xFB, 0xF0, 0x00, 0x80, 0xC0, 0x03, 0x81, 0x15,
+    0x41, 0x55, 0x81, 0xDC, 0x00, 0xE0, 0x84, 0xC8, 0x00, 0x1C, 0x85, 0xBF, 0x81, 0xEE, 0x05, 0x0E,
+    0x1F, 0xFF, 0x0F, 0x00, 0xE0, 0x81, 0x28, 0x83, 0x00, 0x02, 0xE3, 0x00, 0x0F, 0x80, 0xEA, 0x00,
+    0x02, 0x81, 0x18, 0x02, 0x3B, 0x80, 0xE0, 0x80, 0x0E, 0x80, 0x00, 0x01, 0xCC, 0xEC, 0x83, 0xE0,
+    0x00, 0x00, 0x81, 0x18, 0x14, 0x00, 0x7F, 0xC0, 0x00, 0x10, 0x02, 0x05, 0x60, 0x8F, 0xBF, 0xBF,
+    0xE4, 0x00, 0x1F, 0x1F, 0xF1, 0xFF, 0xF8, 0x0F, 0xFF, 0x3F, 0x80, 0xE8, 0x00, 0x31, 0x84, 0x00,
+    0x02, 0x10, 0x00, 0x1F, 0x80, 0xE0, 0x01, 0x00, 0x3C, 0x81, 0x00, 0x01, 0xFF, 0xE0, 0x81, 0x00,
+    0x02, 0x00, 0x01, 0xFE, 0x80, 0x00, 0x05, 0xF3, 0xF8, 0x3F, 0x83, 0x00, 0x83, 0x83, 0x3F, 0x03,
+    0x07, 0xFF, 0xC0, 0x6C, 0x84, 0x00, 0x01, 0xE7, 0xFE, 0x82, 0x1E, 0x80, 0xD4, 0x15, 0x80, 0x0F,
+    0xF8, 0xFF, 0x87, 0x7F, 0xBF, 0xFF, 0xFF, 0xFE, 0x6F, 0xC0, 0x1F, 0xFF, 0xFF, 0xF3, 0x3E, 0x7F,
+    0x40, 0x06, 0xFA, 0x80, 0x80, 0xE2, 0x02, 0xE1, 0xFE, 0x07, 0x82, 0x00, 0x80, 0xFF, 0x00, 0xF8,
+    0x89, 0x00, 0x00, 0x7F, 0x81, 0xC0, 0x00, 0xF9, 0x80, 0x08, 0x80, 0xFF, 0x05, 0xFB, 0xAA, 0x7F,
+    0xFF, 0xFF, 0x80, 0x81, 0x5D, 0x80, 0x9E, 0x03, 0x08, 0x0E, 0x00, 0x7F, 0x80, 0xF5, 0x02, 0x03,
+    0xFF, 0xFB, 0x81, 0x95, 0x04, 0xFF, 0xFE, 0xEA, 0xBF, 0xAA, 0x81, 0xDC, 0x83, 0x84, 0x02, 0x00,
+    0x00, 0x3C, 0x87, 0x00, 0x02, 0x18, 0x00, 0x0C, 0x8C, 0x00, 0x06, 0xE7, 0x00, 0x0F, 0xC0, 0x04,
+    0x00, 0x06, 0x80, 0xF2, 0x03, 0x01, 0x15, 0x00, 0x40, 0x80, 0x0E, 0x80, 0x00, 0x01, 0xC9, 0xF9,
+    0x84, 0x00, 0x00, 0x07, 0x81, 0xF8, 0x02, 0xE1, 0xE0, 0x02, 0x80, 0x20, 0x01, 0x0C, 0xCF, 0x80,
+    0xA7, 0x02, 0x00, 0x0E, 0x0F, 0x80, 0x00, 0x01, 0x1F, 0xEC, 0x81, 0xE8, 0x00, 0x78, 0x8B, 0x00,
+    0x00, 0x14, 0x81, 0x00, 0x02, 0xDF, 0xE0, 0x5F, 0x86, 0x00, 0x06, 0xD1, 0xF8, 0x7F, 0xC1, 0x00,
+    0x83, 0xE0, 0x82, 0xB8, 0x00, 0x0F, 0x80, 0x74, 0x84, 0x00, 0x01, 0xE3, 0xFC, 0x87, 0x00, 0x04,
+    0xF0, 0xFF, 0x98, 0x1C, 0x9F, 0x80, 0xF3, 0x02, 0x4F, 0xF0, 0x73, 0x80, 0x00, 0x05, 0x1F, 0xBE,
+    0x00, 0x07, 0xF0, 0x00, 0x80, 0xE2, 0x02, 0xC1, 0xFC, 0x0F, 0x80, 0xB5, 0x01, 0xFF, 0xF8, 0x8D,
+    0x00, 0x00, 0x3F, 0x82, 0x00, 0x00, 0xC7, 0x80, 0xE9, 0x04, 0xDF, 0xFF, 0x95, 0x55, 0xE0, 0x83,
+    0x00, 0x00, 0x07, 0x80, 0xFB, 0x02, 0x30, 0x06, 0x0D, 0x80, 0x9F, 0x01, 0xC0, 0x03, 0x80, 0x5F,
+    0x80, 0x95, 0x04, 0xFF, 0x55, 0x15, 0x57, 0xD5, 0x81, 0x9C, 0x81, 0xE1, 0x81, 0xFF, 0x03, 0x70,
+    0x08, 0x00, 0x01, 0x82, 0xF4, 0x02, 0xFF, 0xC0, 0x1E, 0x81, 0xDF, 0x03, 0x1F, 0x00, 0xE0, 0x6F,
+    0x86, 0x00, 0x00, 0xEF, 0x82, 0xF6, 0x05, 0xFF, 0xE0, 0x3F, 0xFF, 0x81, 0x3A, 0x80, 0xDB, 0x80,
+    0xC1, 0x03, 0xFF, 0x83, 0x31, 0xD1, 0x84, 0x00, 0x00, 0x87, 0x80, 0xF8, 0x02, 0x07, 0xC1, 0xF0,
+    0x80, 0x20, 0x01, 0x05, 0x50, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x0C, 0x80, 0xE0, 0x02, 0xF0, 0x3F,
+    0xB0, 0x81, 0x00, 0x05, 0x7E, 0x7F, 0x1F, 0xFF, 0xFF, 0x0F, 0x80, 0xCD, 0x06, 0x01, 0xFF, 0x00,
+    0x90, 0x02, 0x05, 0x01, 0x82, 0x00, 0x01, 0xFE, 0x0F, 0x81, 0x00, 0x0B, 0x03, 0xFF, 0xBF, 0x00,
+    0x00, 0x80, 0xB8, 0x3F, 0xE0, 0x00, 0x83, 0xF0, 0x81, 0xB9, 0x05, 0x03, 0xFA, 0xFB, 0xFF, 0x00,
+    0x8F, 0x82, 0x00, 0x03, 0xC0, 0x01, 0xFC, 0x07, 0x84, 0x00, 0x05, 0xE0, 0x0F, 0xFC, 0x7F, 0x89,
+    0x0C, 0x81, 0x00, 0x02, 0xEF, 0xFF, 0xF0, 0x80, 0xEB, 0x11, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x0F,
+    0xF9, 0xE3, 0xFF, 0x81, 0xF8, 0x1F, 0x00, 0x00, 0xA8, 0x7F, 0xFC, 0x7F, 0x81, 0xD7, 0x86, 0x3A,
+    0x81, 0x00, 0x80, 0xFF, 0x00, 0xF9, 0x80, 0x03, 0x06, 0xE0, 0x3F, 0xE0, 0xAA, 0xAA, 0x9F, 0x6E,
+    0x82, 0xE5, 0x00, 0x06, 0x80, 0xFC, 0x02, 0x60, 0x0E, 0x0E, 0x80, 0x8A, 0x10, 0x80, 0x03, 0xFF,
+    0xFC, 0x00, 0x00, 0x0D, 0x55, 0x54, 0xAA, 0xFE, 0xAF, 0xAA, 0xE3, 0xF9, 0xEC, 0xE8, 0x86, 0xC6,
+    0x03, 0x08, 0x00, 0x0F, 0xE0, 0x81, 0xF8, 0x09, 0x78, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0x9F, 0x7F,
+    0x00, 0xE0, 0x83, 0x20, 0x80, 0x00, 0x01, 0x01, 0xFE, 0x80, 0xF8, 0x0A, 0x02, 0x06, 0x02, 0x3F,
+    0x00, 0xFF, 0xFC, 0x17, 0x81, 0x00, 0xF0, 0x80, 0x20, 0x03, 0xFE, 0x06, 0x66, 0xE7, 0x84, 0x00,
+    0x00, 0xE1, 0x80, 0xBD, 0x01, 0x1F, 0x01, 0x81, 0x00, 0x01, 0x00, 0x04, 0x82, 0x00, 0x08, 0x08,
+    0x0F, 0xFF, 0x1F, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0x80, 0x72, 0x00, 0x9E, 0x80, 0x4C, 0x80, 0xB0,
+    0x02, 0x00, 0x0F, 0x83, 0x81, 0xE0, 0x00, 0x00, 0x82, 0x00, 0x01, 0xFF, 0xC1, 0x81, 0x00, 0x80,
+    0xBB, 0x80, 0xF3, 0x04, 0x3E, 0x1F, 0xF3, 0x00, 0xE1, 0x81, 0x00, 0x06, 0x7F, 0xF7, 0xF0, 0x6F,
+    0xFF, 0xFE, 0x00, 0x80, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0x84, 0x00, 0x05, 0xFF,
+    0x03, 0xFE, 0x7F, 0x91, 0x1C, 0x81, 0x00, 0x81, 0x63, 0x0C, 0x03, 0xFF, 0x07, 0xE0, 0x1F, 0x00,
+    0x07, 0xFF, 0xF9, 0xC3, 0xFF, 0x03, 0xF0, 0x80, 0xA1, 0x02, 0xD7, 0xFF, 0xFE, 0x82, 0x10, 0x00,
+    0xFF, 0x80, 0x9E, 0x86, 0x00, 0x0E, 0xFB, 0xFF, 0xFF, 0x51, 0xFF, 0x0F, 0xFF, 0xEF, 0xDF, 0xDF,
+    0x55, 0x55, 0x64, 0x91, 0xF7, 0x85, 0xE7, 0x02, 0xC0, 0x06, 0x10, 0x81, 0xF9, 0x0F, 0x03, 0xFF,
+    0xF8, 0x00, 0x00, 0x75, 0x55, 0x55, 0x55, 0xFF, 0xBE, 0x55, 0xC1, 0xF0, 0xF8, 0x70, 0x81, 0xEC,
+    0x80, 0x75, 0x07, 0xFF, 0xC0, 0x08, 0x00, 0x2F, 0x80, 0x03, 0xFC, 0x81, 0xF1, 0x04, 0x1F, 0xF8,
+    0x00, 0x07, 0x3F, 0x89, 0x00, 0x00, 0x00, 0x82, 0xE9, 0x0F, 0x0C, 0x02, 0x01, 0xA0, 0xEB, 0xFC,
+    0x81, 0x80, 0x13, 0xF8, 0x0F, 0xFF, 0x07, 0xFE, 0x00, 0x9C, 0x85, 0x00, 0x80, 0xB0, 0x08, 0x00,
+    0x1C, 0x00, 0x60, 0x00, 0x90, 0x17, 0xC3, 0xE8, 0x83, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0x7F,
+    0xC0, 0x81, 0x00, 0x01, 0x9F, 0x8C, 0x80, 0x60, 0x83, 0x69, 0x04, 0x80, 0x70, 0x02, 0x05, 0xBC,
+    0x81, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x80, 0xA3, 0x00, 0x00, 0x80, 0x1E, 0x08, 0x00, 0x00, 0x18,
+    0x0C, 0x1F, 0xFB, 0x00, 0xE1, 0xF2, 0x81, 0xEA, 0x02, 0xEE, 0xC0, 0x1B, 0x80, 0x00, 0x03, 0x7F,
+    0x00, 0xFF, 0xE4, 0x80, 0x00, 0x80, 0x29, 0x00, 0x8F, 0x81, 0x1F, 0x06, 0xFF, 0xFF, 0x83, 0xFF,
+    0xFF, 0x99, 0x0C, 0x83, 0xBC, 0x81, 0xE8, 0x00, 0x03, 0x80, 0x00, 0x06, 0x0F, 0xFF, 0xF9, 0xDF,
+    0xFE, 0x07, 0xF0, 0x80, 0xEC, 0x01, 0xAA, 0x7F, 0x84, 0x00, 0x00, 0xE0, 0x86, 0x00, 0x00, 0x1F,
+    0x81, 0x00, 0x0B, 0x01, 0xFE, 0x1F, 0xFF, 0xEA, 0xBF, 0xAA, 0xAA, 0xAA, 0xAB, 0x6E, 0x08, 0x85,
+    0xE7, 0x02, 0x80, 0x0F, 0xF0, 0x85, 0x00, 0x00, 0x03, 0x81, 0xE6, 0x06, 0xFF, 0xD5, 0xAA, 0xC9,
+    0xF4, 0xD9, 0x32, 0x83, 0xCC, 0x80, 0x00, 0x05, 0x18, 0x00, 0x70, 0x80, 0x0E, 0xAA, 0x82, 0x54,
+    0x06, 0xF8, 0x80, 0x07, 0xBF, 0xFF, 0x00, 0xC0, 0x84, 0x00, 0x03, 0x1F, 0xFE, 0x00, 0x78, 0x80,
+    0xF8, 0x0A, 0x02, 0x10, 0x02, 0x01, 0xF8, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0x7E, 0x81, 0x00, 0x02,
+    0x01, 0x98, 0xC7, 0x88, 0x00, 0x00, 0x7C, 0x80, 0xFC, 0x0F, 0x10, 0x3F, 0xC0, 0x0C, 0xCD, 0xFF,
+    0xFF, 0xFD, 0x80, 0x08, 0x3F, 0xFE, 0x1F, 0xC0, 0xFE, 0x00, 0x82, 0x00, 0x01, 0x48, 0x7F, 0x83,
+    0x44, 0x06, 0x7F, 0xFF, 0x80, 0x10, 0x02, 0x00, 0x40, 0x81, 0x00, 0x03, 0xF7, 0xFF, 0xFC, 0x3F,
+    0x80, 0x00, 0x80, 0x47, 0x80, 0x00, 0x04, 0x0E, 0x1F, 0xFF, 0x00, 0xE1, 0x82, 0xF3, 0x02, 0x4D,
+    0xCF, 0x9F, 0x80, 0x79, 0x01, 0x1F, 0x00, 0x81, 0x34, 0x82, 0x00, 0x00, 0xE0, 0x82, 0x00, 0x04,
+    0xC3, 0xFF, 0xFF, 0x90, 0x3C, 0x85, 0x00, 0x80, 0xE6, 0x07, 0xFB, 0xE0, 0x07, 0xFF, 0xFF, 0xF9,
+    0xFF, 0xFC, 0x82, 0xA8, 0x00, 0xD5, 0x81, 0x04, 0x00, 0x80, 0x80, 0x40, 0x82, 0x25, 0x01, 0x00,
+    0xFF, 0x80, 0x8B, 0x00, 0x0F, 0x80, 0x00, 0x0C, 0xC0, 0x01, 0xFC, 0x3F, 0xFD, 0xF5, 0x5F, 0x55,
+    0xD5, 0x55, 0x54, 0x91, 0xFC, 0x84, 0xC7, 0x02, 0x03, 0x00, 0x07, 0x83, 0xBF, 0x0E, 0xFE, 0xF8,
+    0x00, 0x02, 0xD5, 0x55, 0x55, 0x57, 0xFF, 0xD5, 0x55, 0x9D, 0xE6, 0xD3, 0x37, 0x81, 0xEC, 0x0A,
+    0x38, 0x00, 0x00, 0x3C, 0x00, 0x1E, 0x01, 0xC0, 0x00, 0x1C, 0x03, 0x82, 0x00, 0x01, 0xFF, 0x80,
+    0x80, 0x9C, 0x85, 0x00, 0x01, 0xFC, 0x3F, 0x84, 0x83, 0x80, 0x40, 0x0D, 0x0E, 0x3B, 0xFF, 0xF0,
+    0x01, 0x00, 0x3E, 0x0F, 0xFE, 0x3F, 0xFC, 0x03, 0x6C, 0x9F, 0x84, 0xE8, 0x81, 0x9E, 0x81, 0x00,
+    0x08, 0x93, 0xEF, 0xF8, 0x00, 0xCF, 0xFF, 0xFF, 0xBF, 0xC0, 0x80, 0x00, 0x01, 0x3F, 0xC0, 0x80,
+    0xEA, 0x80, 0x40, 0x03, 0xE7, 0xC0, 0x3F, 0x9F, 0x80, 0x5F, 0x01, 0x00, 0x00, 0x80, 0x5F, 0x03,
+    0x70, 0x02, 0x0B, 0x2C, 0x83, 0x00, 0x04, 0xFF, 0x8F, 0x00, 0xC0, 0x00, 0x82, 0x3F, 0x05, 0x7C,
+    0x02, 0x0F, 0xFF, 0x00, 0xE0, 0x80, 0x19, 0x0A, 0xFF, 0xFE, 0x6F, 0xCF, 0x9B, 0xFF, 0xFF, 0xF3,
+    0x01, 0x00, 0xF8, 0x80, 0x7F, 0x00, 0xF9, 0x81, 0x28, 0x00, 0xC3, 0x80, 0xE0, 0x05, 0xFF, 0xFF,
+    0xE1, 0xFF, 0xFF, 0x86, 0x85, 0x3C, 0x81, 0x41, 0x02, 0xFC, 0x07, 0xE7, 0x80, 0x00, 0x00, 0xFC,
+    0x81, 0xDF, 0x02, 0x00, 0x00, 0xAA, 0x80, 0xBB, 0x80, 0xD0, 0x00, 0x00, 0x84, 0x00, 0x01, 0x00,
+    0x01, 0x82, 0x00, 0x02, 0xF8, 0x00, 0x01, 0x80, 0xB0, 0x02, 0xEA, 0xBE, 0xAA, 0x81, 0xDB, 0x00,
+    0xE0, 0x84, 0xC7, 0x00, 0x06, 0x80, 0xFE, 0x82, 0xFF, 0x81, 0xD4, 0x81, 0xE7, 0x80, 0xFF, 0x03,
+    0x1C, 0xC4, 0xE1, 0x13, 0x81, 0xED, 0x0A, 0xF1, 0x55, 0x50, 0x78, 0x00, 0x0E, 0x07, 0x00, 0x00,
+    0x38, 0x00, 0x81, 0x54, 0x03, 0x3F, 0xFF, 0xF0, 0x1F, 0x80, 0xA2, 0x05, 0x80, 0xFF, 0x1C, 0xCF,
+    0x23, 0x87, 0x81, 0xE0, 0x09, 0xF3, 0xFF, 0xFC, 0xF0, 0x00, 0x06, 0x1E, 0x00, 0x00, 0x20, 0x80,
+    0x48, 0x81, 0xC2, 0x02, 0xFE, 0x3F, 0x03, 0x80, 0xDF, 0x01, 0x03, 0x20, 0x80, 0x90, 0x84, 0x87,
+    0x00, 0x80, 0x81, 0xC7, 0x05, 0x06, 0x06, 0x00, 0x04, 0x00, 0x00, 0x80, 0x52, 0x03, 0x01, 0x00,
+    0xFF, 0xC1, 0x80, 0x61, 0x03, 0x10, 0x00, 0x10, 0x16, 0x81, 0xCF, 0x85, 0xFF, 0x03, 0x06, 0x0F,
+    0x28, 0x0C, 0x80, 0xF9, 0x03, 0x78, 0x08, 0x08, 0xC6, 0x80, 0x82, 0x00, 0xCF, 0x80, 0xFC, 0x01,
+    0x7F, 0xF1, 0x82, 0x24, 0x80, 0x91, 0x81, 0xF8, 0x16, 0x01, 0xD5, 0x1F, 0xF0, 0x07, 0xFF, 0xF8,
+    0x40, 0x04, 0x61, 0x3E, 0xE4, 0xF3, 0x8F, 0x9B, 0xF7, 0xFF, 0x81, 0xDF, 0xFF, 0xFF, 0xDF, 0xFE,
+    0x80, 0x32, 0x01, 0xE1, 0xF7, 0x80, 0xB1, 0x80, 0xDF, 0x15, 0xF8, 0x00, 0x60, 0xFF, 0xF8, 0x1C,
+    0xC0, 0xFF, 0x1D, 0xCF, 0x50, 0x79, 0xD9, 0xFF, 0xCF, 0xC0, 0x3C, 0x81, 0xE6, 0x7F, 0xF8, 0x1F,
+    0x85, 0xA0, 0x14, 0x78, 0xC0, 0x38, 0xC0, 0x7C, 0x7F, 0x7C, 0xFF, 0x80, 0xFF, 0xFF, 0x8F, 0x00,
+    0x1F, 0x38, 0x03, 0xC0, 0x00, 0xF0, 0x7E, 0x70, 0x81, 0x4A, 0x80, 0x0D, 0x09, 0x04, 0x02, 0x00,
+    0x78, 0x83, 0xBB, 0xFF, 0xBF, 0x83, 0xFF, 0x80, 0xB1, 0x0A, 0x00, 0x00, 0xE7, 0xE7, 0xEF, 0xC0,
+    0x3F, 0x00, 0x07, 0xEF, 0x0F, 0x81, 0x48, 0x1A, 0xF8, 0x00, 0x00, 0x08, 0xC0, 0x10, 0xE4, 0xFF,
+    0x00, 0xDF, 0xF8, 0x7F, 0xF3, 0x18, 0x08, 0x8F, 0xF0, 0x1F, 0xC0, 0x01, 0x5B, 0xF0, 0x40, 0x7F,
+    0x1C, 0x0E, 0x03, 0x81, 0x00, 0x0C, 0x01, 0xCF, 0xFF, 0xFE, 0xE0, 0x00, 0x06, 0x3C, 0x00, 0x00,
+    0xE0, 0x00, 0x30, 0x80, 0xF0, 0x00, 0x7F, 0x80, 0x47, 0x01, 0x03, 0xFE, 0x80, 0xC2, 0x02, 0x04,
+    0x08, 0x02, 0x8B, 0x00, 0x01, 0x0F, 0x00, 0x80, 0x20, 0x00, 0x78, 0x81, 0xF0, 0x01, 0xFF, 0x81,
+    0x80, 0x9B, 0x03, 0x80, 0x90, 0xFC, 0x77, 0x81, 0xE8, 0x86, 0x00, 0x01, 0x06, 0x13, 0x80, 0x19,
+    0x04, 0x01, 0xC0, 0x33, 0x08, 0xEC, 0x80, 0xBD, 0x01, 0x0F, 0x0E, 0x80, 0xFB, 0x02, 0xF0, 0xFC,
+    0x00, 0x80, 0xDE, 0x00, 0x3F, 0x84, 0x00, 0x14, 0xCA, 0x7F, 0xE0, 0x07, 0xFF, 0xF0, 0x40, 0x03,
+    0xC1, 0x3C, 0xE7, 0xF7, 0xCF, 0xF7, 0xEB, 0xAF, 0xC1, 0xD7, 0xFF, 0xFF, 0xAF, 0x81, 0x91, 0x01,
+    0xE7, 0xC3, 0x82, 0x00, 0x07, 0x00, 0x00, 0x03, 0xC3, 0xFF, 0xF8, 0x3F, 0xC7, 0x81, 0x20, 0x09,
+    0xF9, 0xBE, 0xFC, 0xFE, 0xC0, 0x31, 0xF1, 0xE2, 0x63, 0xE0, 0x80, 0xE9, 0x00, 0x18, 0x82, 0xE3,
+    0x07, 0xE1, 0x00, 0xE0, 0xC1, 0xF8, 0xFE, 0xFB, 0xFE, 0x80, 0xCE, 0x08, 0xE4, 0x0F, 0xDF, 0x20,
+    0x03, 0x80, 0x00, 0xF8, 0x7E, 0x80, 0x05, 0x00, 0x60, 0x80, 0x48, 0x18, 0x00, 0x04, 0x06, 0x00,
+    0x79, 0xC7, 0x3B, 0xFF, 0xFC, 0x2F, 0xFB, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x67, 0xA7, 0xE5, 0x80,
+    0x3F, 0x00, 0x0E, 0x1F, 0xCF, 0x80, 0xC9, 0x17, 0x1F, 0xE8, 0x00, 0x10, 0x39, 0xE0, 0x20, 0xFF,
+    0xFF, 0x06, 0x60, 0xF8, 0x7F, 0xE7, 0xC3, 0xE1, 0x87, 0xE0, 0x7F, 0xC0, 0x01, 0x80, 0x01, 0xF8,
+    0x86, 0x00, 0x00, 0x80, 0x80, 0x4C, 0x07, 0x3C, 0x06, 0x70, 0x00, 0x00, 0xC0, 0x00, 0x20, 0x80,
+    0xF0, 0x0C, 0xF0, 0x00, 0x7F, 0xFF, 0x47, 0xF8, 0x3F, 0x00, 0x0F, 0x04, 0x02, 0x01, 0x82, 0x85,
+    0x00, 0x81, 0x7B, 0x02, 0x06, 0x3F, 0x80, 0x80, 0x00, 0x00, 0x08, 0x80, 0xD2, 0x02, 0x3F, 0xFF,
+    0x8F, 0x80, 0x4F, 0x03, 0x98, 0xB6, 0xFD, 0xFF, 0x8A, 0x00, 0x01, 0x00, 0x47, 0x80, 0x19, 0x09,
+    0x03, 0x40, 0x11, 0x08, 0xF8, 0xFF, 0xFF, 0xFE, 0x1E, 0x1C, 0x80, 0x27, 0x01, 0xF8, 0x7F, 0x81,
+    0x00, 0x02, 0x7F, 0xF1, 0xF8, 0x80, 0xD1, 0x1C, 0x0E, 0x00, 0xD4, 0xFF, 0xE0, 0x07, 0x57, 0xE0,
+    0x00, 0x03, 0x83, 0xF1, 0xE7, 0x70, 0xCF, 0xFF, 0x9F, 0xF7, 0xC0, 0xFF, 0xFC, 0x03, 0xFF, 0x6B,
+    0xFF, 0xFF, 0x7F, 0x8F, 0x0B, 0x80, 0x38, 0x81, 0xFF, 0x13, 0x07, 0x03, 0xF3, 0xE1, 0xFF, 0xFF,
+    0x56, 0xFB, 0xCA, 0x3F, 0xFC, 0x7B, 0xE0, 0xCD, 0xC0, 0x33, 0xF6, 0xCC, 0x42, 0x40, 0x80, 0xE9,
+    0x80, 0x89, 0x80, 0x7B, 0x0C, 0xC1, 0x00, 0xE1, 0xC3, 0xC0, 0x7F, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
+    0xE7, 0x5F, 0x80, 0x00, 0x04, 0x00, 0x00, 0xFE, 0x1C, 0xD0, 0x80, 0xE7, 0x00, 0x03, 0x80, 0x00,
+    0x17, 0x18, 0x0E, 0x03, 0xF8, 0x7F, 0xFB, 0x3F, 0xF1, 0x7F, 0xF0, 0x76, 0x3F, 0xF8, 0x00, 0x00,
+    0x27, 0xA7, 0xE0, 0x00, 0x3F, 0x40, 0x1F, 0x0F, 0x93, 0x80, 0xC9, 0x1A, 0xFF, 0xE0, 0x00, 0x70,
+    0x70, 0xC7, 0x40, 0xFF, 0xAF, 0x20, 0x0F, 0xF0, 0x7F, 0xE7, 0xE1, 0xF1, 0x87, 0xC0, 0xFF, 0xC0,
+    0x01, 0xA8, 0xFB, 0xF0, 0x78, 0x1C, 0x0F, 0x82, 0x00, 0x07, 0x03, 0x9F, 0xAA, 0xAB, 0x80, 0x70,
+    0x03, 0xC0, 0x81, 0x00, 0x00, 0x30, 0x80, 0xF0, 0x0B, 0xE0, 0x00, 0x1F, 0xFF, 0xCF, 0xF0, 0x7F,
+    0x00, 0x1F, 0x08, 0x00, 0x21, 0x88, 0x22, 0x85, 0x00, 0x0C, 0x00, 0x00, 0x02, 0x20, 0xFF, 0xFF,
+    0x1F, 0xF3, 0x00, 0x00, 0xBD, 0xF7, 0xFF, 0x8C, 0x00, 0x00, 0x53, 0x80, 0x30, 0x04, 0x06, 0x00,
+    0x32, 0x88, 0xF1, 0x80, 0x00, 0x02, 0x3E, 0x3C, 0xFC, 0x80, 0xFA, 0x00, 0x1F, 0x80, 0xA9, 0x01,
+    0x00, 0xFF, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x0A, 0xF3, 0xFF, 0xC0, 0x04, 0x0F, 0xC0, 0x00,
+    0x0E, 0x07, 0xE1, 0x8E, 0x80, 0xF4, 0x0C, 0x7F, 0xBF, 0xC0, 0xDB, 0xE0, 0x03, 0xEF, 0x7E, 0xFF,
+    0xFE, 0x7F, 0x9C, 0x0F, 0x84, 0xBD, 0x02, 0x0E, 0x03, 0xE3, 0x80, 0x00, 0x0A, 0xAF, 0xFB, 0x8F,
+    0x3F, 0xBE, 0x5F, 0xA0, 0xEA, 0x80, 0x23, 0xEF, 0x82, 0x8F, 0x03, 0x00, 0x04, 0x00, 0x02, 0x80,
+    0x58, 0x03, 0xC1, 0x00, 0xE3, 0x8F, 0x80, 0x00, 0x01, 0xFD, 0x5F, 0x80, 0x00, 0x02, 0xCF, 0xDF,
+    0x20, 0x80, 0xCC, 0x01, 0x78, 0xEB, 0x80, 0x05, 0x82, 0xFF, 0x0A, 0x14, 0x1E, 0x31, 0xF0, 0x7F,
+    0xF7, 0x87, 0x4F, 0xAB, 0x8F, 0x7E, 0x81, 0x00, 0x08, 0x07, 0xA0, 0x07, 0xE0, 0x3F, 0x00, 0x1F,
+    0xA7, 0xB8, 0x80, 0x52, 0x1C, 0xFF, 0xC0, 0x00, 0x60, 0xE1, 0xEF, 0x60, 0xFF, 0x9F, 0x30, 0x7F,
+    0xF8, 0x7F, 0x87, 0xEE, 0x72, 0x87, 0xC0, 0xFE, 0xC0, 0x00, 0x01, 0xFD, 0xF8, 0x60, 0x1C, 0x0E,
+    0x03, 0x82, 0x80, 0xC5, 0x01, 0x07, 0x1F, 0x80, 0x39, 0x01, 0xE0, 0x03, 0x80, 0xF6, 0x02, 0x80,
+    0x00, 0x18, 0x80, 0xFA, 0x08, 0x40, 0x00, 0x0F, 0xFF, 0x1F, 0xF7, 0xFF, 0x00, 0x3F, 0x80, 0xF6,
+    0x80, 0x89, 0x8F, 0x00, 0x04, 0x04, 0x30, 0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x80, 0xFF,
+    0x82, 0x00, 0x00, 0x01, 0x82, 0xFA, 0x03, 0x00, 0x07, 0x00, 0x87, 0x80, 0x00, 0x0B, 0xCC, 0x00,
+    0x11, 0x08, 0xE3, 0xFC, 0x03, 0xFE, 0xFC, 0x78, 0xFC, 0x3F, 0x85, 0x00, 0x01, 0xFF, 0xF9, 0x80,
+    0xD7, 0x02, 0x06, 0x00, 0x3F, 0x80, 0x75, 0x16, 0x0F, 0x01, 0xC0, 0x0C, 0x0F, 0xC3, 0xCE, 0x7D,
+    0xF7, 0xFF, 0xFA, 0xF7, 0xF0, 0xDF, 0xC1, 0xF3, 0xF7, 0x6F, 0xFF, 0xF8, 0x7F, 0x98, 0x3F, 0x84,
+    0x9C, 0x02, 0x1C, 0x07, 0xCF, 0x80, 0xAB, 0x0B, 0xEF, 0xFB, 0xCF, 0x3F, 0xFE, 0xF7, 0x80, 0xD5,
+    0x80, 0x06, 0x0F, 0x9E, 0x83, 0xE8, 0x0C, 0x06, 0x00, 0x00, 0x70, 0x0F, 0x80, 0x01, 0xE7, 0xFF,
+    0x00, 0xFF, 0x1E, 0x0F, 0x80, 0xDE, 0x01, 0xE7, 0x4F, 0x80, 0xB6, 0x03, 0x00, 0x00, 0x53, 0xE1,
+    0x8A, 0x00, 0x05, 0xFF, 0xC3, 0x3F, 0x9F, 0x0F, 0xBF, 0x82, 0x00, 0x07, 0x01, 0xE7, 0xE0, 0x1F,
+    0x10, 0x1F, 0x71, 0x3C, 0x80, 0xC5, 0x80, 0x62, 0x19, 0xE3, 0xC3, 0xFF, 0xC0, 0xFE, 0x2F, 0x98,
+    0x78, 0xF0, 0x7F, 0x9B, 0x8E, 0x04, 0x07, 0xC1, 0xD6, 0xC0, 0x00, 0x54, 0xF9, 0xF0, 0x40, 0x1C,
+    0x06, 0x01, 0x88, 0x80, 0xC5, 0x09, 0x02, 0xA0, 0x7F, 0xFF, 0x80, 0xC0, 0x03, 0x80, 0x00, 0x01,
+    0x80, 0x1C, 0x80, 0x33, 0x80, 0xC2, 0x06, 0xFF, 0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0x08, 0x80, 0xF4,
+    0x00, 0x20, 0x87, 0x00, 0x00, 0x00, 0x85, 0x00, 0x04, 0x08, 0x30, 0xF7, 0xE7, 0x7F, 0x84, 0x00,
+    0x82, 0x80, 0x00, 0x07, 0x83, 0x7A, 0x10, 0x03, 0x01, 0x2F, 0xF8, 0x03, 0xFF, 0xF8, 0x00, 0x30,
+    0x18, 0xE3, 0xFC, 0x02, 0xF8, 0xF8, 0x60, 0xFE, 0x80, 0xBA, 0x01, 0x1F, 0xF0, 0x80, 0xE8, 0x0C,
+    0xF1, 0xFF, 0xFF, 0xF7, 0x80, 0x00, 0x04, 0x00, 0x3F, 0xFB, 0x80, 0x00, 0x1F, 0x80, 0x9B, 0x10,
+    0x3F, 0x00, 0x8A, 0x7E, 0xF3, 0xFA, 0xF7, 0xEF, 0xF0, 0x3D, 0x9E, 0x7C, 0xEE, 0xF6, 0xE7, 0xE0,
+    0xFC, 0x84, 0x9F, 0x04, 0x38, 0x0C, 0x38, 0x0F, 0x87, 0x81, 0xAA, 0x0A, 0xCF, 0x8F, 0xBF, 0xBE,
+    0x6E, 0x00, 0xAA, 0x00, 0x1F, 0x8F, 0x9C, 0x83, 0x02, 0x80, 0x88, 0x01, 0xC0, 0x0E, 0x80, 0x68,
+    0x10, 0xFF, 0x00, 0xCA, 0xFF, 0xBF, 0xFF, 0xE0, 0x1F, 0xE7, 0x48, 0x0F, 0x80, 0x0F, 0x00, 0x07,
+    0xC3, 0xF0, 0x85, 0x00, 0x1A, 0x40, 0x7E, 0x7F, 0xF1, 0xFF, 0x5F, 0xE3, 0xFF, 0x7E, 0x7F, 0x76,
+    0x9F, 0xF8, 0x01, 0x00, 0x07, 0x03, 0xF3, 0xE0, 0x3F, 0x20, 0x3F, 0x3C, 0x7C, 0x00, 0x00, 0x1C,
+    0x80, 0x68, 0x19, 0xC3, 0xBF, 0xFF, 0x80, 0xF0, 0xBF, 0x08, 0x07, 0xE0, 0x7E, 0x7E, 0x1F, 0x8B,
+    0x07, 0xC3, 0xBE, 0xF0, 0x00, 0x29, 0xF9, 0xF8, 0x02, 0x80, 0xA0, 0x50, 0x10, 0x81, 0x00, 0x04,
+    0xAD, 0xA5, 0x15, 0x81, 0x80, 0x86, 0x00, 0x00, 0x03, 0x81, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xC1,
+    0xFF, 0x81, 0xA8, 0x92, 0x00, 0x01, 0x00, 0xE3, 0x80, 0x5A, 0x83, 0x00, 0x80, 0x21, 0x80, 0xD0,
+    0x00, 0xFC, 0x80, 0x9A, 0x16, 0x00, 0x00, 0x01, 0x04, 0x8F, 0xD8, 0x03, 0xFF, 0xE0, 0x00, 0x30,
+    0x30, 0xC7, 0xF9, 0xD8, 0x78, 0xE0, 0x00, 0xFF, 0x87, 0xDF, 0xFF, 0xFF, 0x80, 0x24, 0x04, 0x3F,
+    0xE1, 0xFF, 0xFF, 0xBF, 0x81, 0xD8, 0x0D, 0x1F, 0xDF, 0x00, 0x00, 0x7F, 0xFE, 0x06, 0x30, 0x7F,
+    0x00, 0xCF, 0x7E, 0xE1, 0xF7, 0x80, 0xC3, 0x06, 0x7A, 0x1F, 0xFC, 0x5D, 0x6E, 0x07, 0xC1, 0x82,
+    0xBB, 0x80, 0xFF, 0x04, 0x70, 0x0C, 0x70, 0x1F, 0x0F, 0x80, 0xAB, 0x0B, 0x7F, 0xFF, 0xCF, 0x3F,
+    0xFC, 0x7C, 0x00, 0xAC, 0x00, 0x1F, 0x9B, 0x24, 0x81, 0xE8, 0x00, 0x0C, 0x80, 0x68, 0x04, 0x01,
+    0x80, 0x0E, 0x00, 0xC7, 0x80, 0x8A, 0x00, 0xB5, 0x80, 0x00, 0x05, 0xC0, 0x0B, 0xE7, 0x03, 0xAF,
+    0xC0, 0x80, 0x00, 0x03, 0xE0, 0xF6, 0x60, 0x00, 0x80, 0x9F, 0x80, 0xFF, 0x02, 0x60, 0x79, 0xC3,
+    0x80, 0xC7, 0x11, 0xE0, 0xFD, 0xFC, 0xFD, 0x7D, 0x9F, 0xF0, 0x07, 0x00, 0x01, 0xFB, 0xF7, 0xE0,
+    0x1F, 0x00, 0x77, 0x7C, 0x0E, 0x81, 0x2D, 0x02, 0x0C, 0x01, 0x9C, 0x80, 0xC7, 0x14, 0x27, 0xFA,
+    0x08, 0xDF, 0xE0, 0x7E, 0x7F, 0x17, 0xC0, 0x07, 0xCF, 0x7C, 0xF0, 0x00, 0x44, 0xFC, 0xD0, 0x10,
+    0x02, 0x10, 0x84, 0x84, 0x87, 0x02, 0x01, 0x80, 0x80, 0x80, 0xFA, 0x01, 0x03, 0x04, 0x80, 0x96,
+    0x01, 0x01, 0xFE, 0x80, 0xF1, 0x01, 0xFF, 0x3F, 0x80, 0x95, 0x04, 0xFF, 0x08, 0x00, 0x01, 0x02,
+    0x90, 0x00, 0x04, 0x20, 0x08, 0x08, 0xC3, 0x1F, 0x8A, 0x00, 0x80, 0x4C, 0x81, 0x7A, 0x0D, 0x01,
+    0x8A, 0xAF, 0xF8, 0x03, 0xFF, 0xF0, 0x20, 0x08, 0x31, 0x0E, 0xF9, 0x47, 0x30, 0x80, 0xE0, 0x00,
+    0x83, 0x81, 0xDE, 0x80, 0x0D, 0x03, 0xF1, 0xE3, 0xFF, 0xF7, 0x81, 0xD8, 0x00, 0x0B, 0x80, 0xDA,
+    0x13, 0x7F, 0xFC, 0x0C, 0x60, 0xFF, 0x00, 0x8F, 0x7C, 0xB1, 0xEF, 0xBF, 0xFF, 0xE0, 0x3A, 0x7D,
+    0xDA, 0x6E, 0xE9, 0x07, 0x81, 0x80, 0xBB, 0x81, 0xA7, 0x04, 0x00, 0xE0, 0x18, 0x60, 0x3F, 0x80,
+    0xA6, 0x0F, 0xFF, 0x0F, 0xFC, 0x8F, 0x3F, 0x88, 0x3C, 0x03, 0x40, 0x00, 0x1F, 0x38, 0x60, 0x00,
+    0x00, 0x1C, 0x80, 0x3D, 0x05, 0x30, 0x70, 0x03, 0x00, 0x1C, 0x01, 0x81, 0xB2, 0x01, 0x7F, 0xFE,
+    0x80, 0xFB, 0x0A, 0x03, 0xE5, 0x07, 0xEF, 0xC0, 0x3F, 0x00, 0x07, 0xEF, 0x6F, 0x80, 0x80, 0x00,
+    0x00, 0xF8, 0x81, 0x00, 0x01, 0xFD, 0xFB, 0x81, 0x72, 0x17, 0xFF, 0xF0, 0xFC, 0xFD, 0x9F, 0xF0,
+    0x1F, 0x80, 0x01, 0xA3, 0xF2, 0xE0, 0x7F, 0x08, 0xFC, 0x3E, 0xC8, 0x00, 0x00, 0x38, 0x00, 0x1C,
+    0x03, 0x18, 0x80, 0xCC, 0x0E, 0x4B, 0xF8, 0x04, 0xFF, 0xC0, 0x7A, 0x7F, 0x67, 0x14, 0x07, 0xCF,
+    0xFE, 0xF0, 0x00, 0x19, 0x80, 0xCA, 0x00, 0x3F, 0x94, 0xFF, 0x00, 0x07, 0x81, 0xFF, 0x95, 0xE3,
+    0x84, 0xE1, 0x03, 0x07, 0x3F, 0x37, 0x37, 0x84, 0xF0, 0x85, 0xF8, 0x02, 0x3F, 0x37, 0x17, 0x86,
+    0xE2, 0x02, 0x00, 0x07, 0x07, 0x89, 0xE1, 0x83, 0xEB, 0x00, 0x17, 0x83, 0xF9, 0x84, 0xFF, 0x8A,
+    0xB0, 0x00, 0x02, 0x8C, 0xE6, 0x89, 0xE1, 0x01, 0x02, 0x07, 0x80, 0x20, 0x80, 0xAF, 0x85, 0xE2,
+    0x82, 0xE4, 0x86, 0x82, 0x81, 0x93, 0x02, 0x00, 0x00, 0x02, 0x80, 0xDB, 0x00, 0x40, 0x85, 0xE1,
+    0x80, 0xFC, 0x87, 0x6A, 0x81, 0xA3, 0x00, 0x02, 0x82, 0xE0, 0x86, 0xBD, 0x00, 0x17, 0x83, 0x77,
+    0x8C, 0xE0, 0x88, 0xFF, 0x05, 0x17, 0x37, 0x07, 0x07, 0x16, 0x06, 0x86, 0xDF, 0x88, 0x83, 0x83,
+    0xFF, 0x80, 0xE1, 0x01, 0x02, 0x06, 0x81, 0xBF, 0x80, 0xFB, 0x83, 0x12, 0x00, 0x02, 0x84, 0xBF,
+    0x84, 0x31, 0x81, 0x4B, 0x81, 0xF3, 0x00, 0x07, 0x81, 0xDA, 0x8B, 0x0A, 0x86, 0xBC, 0x81, 0x3E,
+    0x82, 0xF8, 0x8C, 0xA3, 0x84, 0x9F, 0x01, 0x37, 0x17, 0x83, 0xB5, 0x84, 0x9E, 0x81, 0xFF, 0x02,
+    0x07, 0x07, 0x40, 0x84, 0x76, 0x89, 0xCB, 0x82, 0xE7, 0x8D, 0x5E, 0x82, 0xFF, 0x00, 0x06, 0x81,
+    0xFF, 0x82, 0xE1, 0x87, 0xFF, 0x00, 0x40, 0x84, 0xE9, 0x03, 0x37, 0x3F, 0x37, 0x16, 0x8C, 0xE1,
+    0x82, 0xB9, 0x00, 0x00, 0x82, 0xE2, 0x00, 0x06, 0x81, 0x7F, 0x00, 0x37, 0x85, 0xC0, 0x82, 0xDD,
+    0x84, 0xD8, 0x00, 0x00, 0x80, 0xDF, 0x83, 0x80, 0x80, 0x02, 0x85, 0xE0, 0x88, 0xB7, 0x81, 0xF5,
+    0x83, 0x40, 0x81, 0xC0, 0x83, 0x9D, 0x81, 0xFB, 0x01, 0x16, 0x06, 0x83, 0xC0, 0x80, 0xE3, 0x81,
+    0xA1, 0x80, 0xF0, 0x01, 0x16, 0x16, 0x80, 0xFC, 0x80, 0xE7, 0x82, 0xDC, 0x86, 0xB8, 0x80, 0xC5,
+    0x82, 0xEC, 0x83, 0xFE, 0x83, 0xE2, 0x84, 0x6C, 0x83, 0x67, 0x80, 0xC9, 0x81, 0xEC, 0x81, 0xFB,
+    0x00, 0x02, 0x81, 0xFA, 0x84, 0x83, 0x82, 0xE3, 0x81, 0xAB, 0x83, 0xD9, 0x00, 0x02, 0x83, 0xF7,
+    0x85, 0xE0, 0x83, 0xC7, 0x82, 0x0E, 0x81, 0xE7, 0x00, 0x16, 0x83, 0xE0, 0xFF
+};
+
 #endif // SPRITES_H